@@ -0,0 +1,479 @@
+﻿#include "Benchmark.h"
+#include "GameObject.h"
+#include "Transform.h"
+#include "ScriptBehaviour.h"
+#include "ObjectManager.h"
+#include "BehaviourManager.h"
+#include "ObjectPool.h"
+#include "rttr/registration"
+#include <algorithm>
+
+using namespace MMMEngine;
+using namespace MMMEngine::Benchmark;
+
+namespace
+{
+	// 브로드캐스트 측정용 스크립트 (Update 한 개만 등록)
+	// Instantiate 가 컴포넌트를 복제할 수 있게 유저 스크립트와 같은 방식으로 rttr 등록 (파일 끝)
+	class BenchBehaviour : public ScriptBehaviour
+	{
+	private:
+		RTTR_ENABLE(ScriptBehaviour)
+		uint64_t m_counter = 0;
+		float m_speed = 1.0f;			// 복제 시 값 복사 (Copy)
+		ObjPtr<GameObject> m_target;	// 복제 시 계층 안 대상으로 다시 연결 (ObjectRef)
+	public:
+		BenchBehaviour()
+		{
+			REGISTER_BEHAVIOUR_MESSAGE(Update);
+		}
+
+		void Update() { ++m_counter; }
+		uint64_t GetCounter() const { return m_counter; }
+
+		float GetSpeed() const { return m_speed; }
+		void SetSpeed(float _speed) { m_speed = _speed; }
+		ObjPtr<GameObject> GetTarget() const { return m_target; }
+		void SetTarget(ObjPtr<GameObject> _target) { m_target = _target; }
+	};
+
+	std::vector<ObjPtr<GameObject>> SpawnObjects(size_t _count)
+	{
+		std::vector<ObjPtr<GameObject>> objects;
+		objects.reserve(_count);
+		for (size_t i = 0; i < _count; ++i)
+			objects.push_back(Object::NewObject<GameObject>("BenchObject"));
+		return objects;
+	}
+
+	void ObjectCreateDestroy(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 10000 : 100000;
+		std::vector<ObjPtr<GameObject>> objects;
+
+		const double createMs = MeasureMs([&]() { objects = SpawnObjects(count); });
+		const double destroyMs = MeasureMs([&]()
+			{
+				for (auto& go : objects)
+					Object::Destroy(go);
+				FlushDestroy();
+			});
+
+		_result.iterations = count;
+		_result.totalMs = createMs + destroyMs;
+		_result.AddMetric("objects", static_cast<double>(count));
+		_result.AddMetric("createNsPerObject", createMs * 1.0e6 / count);
+		_result.AddMetric("destroyNsPerObject", destroyMs * 1.0e6 / count);
+		_result.AddMetric("liveObjectsAfter", static_cast<double>(ObjectManager::Get().GetLiveObjectCount()));
+	}
+	MMM_BENCHMARK("Core/ObjectCreateDestroy", ObjectCreateDestroy);
+
+	// 큰 계층을 루트 하나로 파괴했을 때 프레임당 삭제 시간 (예산 적용)
+	void HierarchyDestroyBudget(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 5000 : 30000;
+		const size_t fanOut = 8;
+
+		auto root = Object::NewObject<GameObject>("BenchRoot");
+		std::vector<ObjPtr<Transform>> parents{ root->GetTransform() };
+		for (size_t i = 1; i < count; ++i)
+		{
+			auto child = Object::NewObject<GameObject>("BenchNode");
+			child->GetTransform()->SetParent(parents[(i - 1) / fanOut], false);
+			parents.push_back(child->GetTransform());
+		}
+
+		auto& objectManager = ObjectManager::Get();
+		const double markMs = MeasureMs([&]()
+			{
+				Object::Destroy(root);
+				objectManager.UpdateInternalTimer(0.0f);
+				BehaviourManager::Get().DisableBehaviours();
+			});
+
+		size_t frames = 0;
+		double maxFrameMs = 0.0;
+		const double deleteMs = MeasureMs([&]()
+			{
+				do
+				{
+					const double frameMs = MeasureMs([&]() { objectManager.ProcessPendingDestroy(); });
+					maxFrameMs = std::max(maxFrameMs, frameMs);
+					++frames;
+				} while (objectManager.GetPendingDestroyCount() > 0);
+			});
+
+		_result.iterations = count;
+		_result.totalMs = markMs + deleteMs;
+		_result.AddMetric("objects", static_cast<double>(count));
+		_result.AddMetric("markMs", markMs);
+		_result.AddMetric("frames", static_cast<double>(frames));
+		_result.AddMetric("maxFrameMs", maxFrameMs);
+		_result.AddMetric("budgetUs", static_cast<double>(objectManager.GetDestroyBudgetMicroseconds()));
+	}
+	MMM_BENCHMARK("Core/HierarchyDestroyBudget", HierarchyDestroyBudget);
+
+	// 지연 파괴 타이머 처리 비용 (대부분 아직 만료되지 않은 상태에서 매 프레임 갱신)
+	void DelayedDestroyTimers(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 10000 : 100000;
+		const size_t frames = _config.quick ? 100 : 600;
+		const float dt = 1.0f / 60.0f;
+
+		auto objects = SpawnObjects(count);
+		for (size_t i = 0; i < count; ++i)
+			Object::Destroy(objects[i], 1.0f + static_cast<float>(i % 1000) * 0.1f);
+
+		auto& objectManager = ObjectManager::Get();
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t f = 0; f < frames; ++f)
+					objectManager.UpdateInternalTimer(dt);
+			});
+
+		_result.iterations = frames;
+		_result.AddMetric("timers", static_cast<double>(count));
+		_result.AddMetric("timersLeft", static_cast<double>(objectManager.GetDelayedDestroyCount()));
+
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/DelayedDestroyTimers", DelayedDestroyTimers);
+
+	void ObjPtrDereference(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 10000 : 50000;
+		const size_t rounds = _config.quick ? 20 : 200;
+		auto objects = SpawnObjects(count);
+		for (size_t i = 0; i < count; ++i)
+			objects[i]->SetLayer(static_cast<uint32_t>(i & 31));
+
+		uint64_t sum = 0;
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+					for (auto& go : objects)
+						sum += go->GetLayer();
+			});
+		DoNotOptimize(sum);
+
+		_result.iterations = count * rounds;
+		_result.AddMetric("objects", static_cast<double>(count));
+
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/ObjPtrDereference", ObjPtrDereference);
+
+	void TransformHierarchy(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t chains = _config.quick ? 100 : 1000;
+		const size_t depth = _config.quick ? 8 : 16;
+		const size_t rounds = _config.quick ? 20 : 100;
+
+		// 루트 하나에 depth 길이의 체인을 chains 개 매달고 루트만 움직임
+		std::vector<ObjPtr<GameObject>> roots;
+		std::vector<ObjPtr<Transform>> leaves;
+		roots.reserve(chains);
+		leaves.reserve(chains);
+
+		const double buildMs = MeasureMs([&]()
+			{
+				for (size_t c = 0; c < chains; ++c)
+				{
+					auto root = Object::NewObject<GameObject>("BenchRoot");
+					ObjPtr<Transform> parent = root->GetTransform();
+					for (size_t d = 1; d < depth; ++d)
+					{
+						auto child = Object::NewObject<GameObject>("BenchNode");
+						child->GetTransform()->SetParent(parent, false);
+						child->GetTransform()->SetLocalPosition(0.0f, 1.0f, 0.0f);
+						parent = child->GetTransform();
+					}
+					roots.push_back(root);
+					leaves.push_back(parent);
+				}
+			});
+
+		float checksum = 0.0f;
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+				{
+					const float offset = static_cast<float>(r);
+					for (auto& root : roots)
+						root->GetTransform()->SetLocalPosition(offset, 0.0f, 0.0f);
+					// 리프의 월드행렬을 읽을때 dirty 체인 전체가 다시 계산됨
+					for (auto& leaf : leaves)
+						checksum += leaf->GetWorldMatrix()._42;
+				}
+			});
+		DoNotOptimize(static_cast<uint64_t>(checksum));
+
+		_result.iterations = chains * depth * rounds;
+		_result.AddMetric("nodes", static_cast<double>(chains * depth));
+		_result.AddMetric("depth", static_cast<double>(depth));
+		_result.AddMetric("buildMs", buildMs);
+
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/TransformHierarchy", TransformHierarchy);
+
+	void BehaviourBroadcast(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 2000 : 20000;
+		const size_t rounds = _config.quick ? 20 : 100;
+
+		std::vector<ObjPtr<BenchBehaviour>> scripts;
+		scripts.reserve(count);
+		for (auto& go : SpawnObjects(count))
+			scripts.push_back(go->AddComponent<BenchBehaviour>());
+
+		auto& behaviours = BehaviourManager::Get();
+		const double initMs = MeasureMs([&]() { behaviours.InitializeBehaviours(); });
+
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+					behaviours.BroadCastBehaviourMessage("Update");
+			});
+
+		// 스크립트 타입별 비용 집계를 켠 상태의 오버헤드
+		behaviours.SetScriptProfiling(true);
+		const double profiledMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+					behaviours.BroadCastBehaviourMessage("Update");
+			});
+		behaviours.SetScriptProfiling(false);
+		behaviours.ResetScriptProfile();
+
+		uint64_t calls = 0;
+		for (auto& script : scripts)
+			calls += script->GetCounter();
+		DoNotOptimize(calls);
+
+		_result.iterations = count * rounds;
+		_result.AddMetric("scripts", static_cast<double>(count));
+		_result.AddMetric("initializeMs", initMs);
+		_result.AddMetric("profiledNsPerCall", profiledMs * 1.0e6 / static_cast<double>(count * rounds));
+
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/BehaviourBroadcast", BehaviourBroadcast);
+
+	// 루트 아래에 _nodeCount-1 개를 폭 4로 매단 비활성 프리팹
+	// 노드마다 스크립트 하나 (Speed 는 값 복사, Target 은 부모 노드를 가리켜서 복제 때 다시 연결됨)
+	ObjPtr<GameObject> BuildPrefab(size_t _nodeCount)
+	{
+		auto root = Object::NewObject<GameObject>("BenchPrefab");
+		root->AddComponent<BenchBehaviour>()->SetTarget(root);
+		std::vector<ObjPtr<Transform>> nodes{ root->GetTransform() };
+		for (size_t i = 1; i < _nodeCount; ++i)
+		{
+			auto node = Object::NewObject<GameObject>("BenchPrefabNode");
+			auto script = node->AddComponent<BenchBehaviour>();
+			script->SetSpeed(static_cast<float>(i));
+			script->SetTarget(nodes[(i - 1) / 4]->GetGameObject());
+			node->GetTransform()->SetParent(nodes[(i - 1) / 4], false);
+			node->GetTransform()->SetLocalPosition(static_cast<float>(i), 0.0f, 0.0f);
+			nodes.push_back(node->GetTransform());
+		}
+		root->SetActive(false);
+		return root;
+	}
+
+	// 같은 프리팹을 Instantiate/Destroy 로 돌릴 때와 ObjectPool 로 돌릴 때 비교
+	void PooledSpawn(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t nodeCount = 8;
+		const size_t count = _config.quick ? 200 : 1000;
+		const size_t rounds = _config.quick ? 5 : 20;
+
+		auto prefab = BuildPrefab(nodeCount);
+		std::vector<ObjPtr<GameObject>> spawned;
+		spawned.reserve(count);
+
+		double instantiateMs = 0.0;
+		for (size_t r = 0; r < rounds; ++r)
+		{
+			instantiateMs += MeasureMs([&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+						spawned.push_back(Object::Instantiate(prefab));
+				});
+			for (auto& go : spawned)
+				Object::Destroy(go);
+			spawned.clear();
+			FlushDestroy();
+		}
+
+		ObjectPool pool(prefab, count);
+		double poolMs = 0.0;
+		for (size_t r = 0; r < rounds; ++r)
+		{
+			poolMs += MeasureMs([&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+						spawned.push_back(pool.Get({ 0.0f, static_cast<float>(i), 0.0f }, DirectX::SimpleMath::Quaternion::Identity));
+				});
+			for (auto& go : spawned)
+				pool.Release(go);
+			spawned.clear();
+
+			// 반환분은 DisableBehaviours 를 한번 거친 뒤에 재사용됨
+			FlushDestroy();
+		}
+
+		const auto& stats = pool.GetStats();
+		_result.iterations = count * rounds;
+		_result.totalMs = poolMs;
+		_result.AddMetric("nodesPerPrefab", static_cast<double>(nodeCount));
+		_result.AddMetric("instantiateNsPerSpawn", instantiateMs * 1.0e6 / static_cast<double>(count * rounds));
+		_result.AddMetric("poolNsPerSpawn", poolMs * 1.0e6 / static_cast<double>(count * rounds));
+		_result.AddMetric("poolHits", static_cast<double>(stats.hitCount));
+		_result.AddMetric("poolMisses", static_cast<double>(stats.missCount));
+
+		pool.Clear();
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/PooledSpawn", PooledSpawn);
+
+	// 200 노드 프리팹 반복 Instantiate (클론 플랜 캐시 적중) vs 매번 플랜을 새로 만드는 경우
+	void InstantiatePlan(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t nodeCount = 200;
+		const size_t total = _config.quick ? 500 : 10000;
+		const size_t batch = 50;
+		const size_t uncachedCount = _config.quick ? 50 : 200;
+
+		auto prefab = BuildPrefab(nodeCount);
+		std::vector<ObjPtr<GameObject>> spawned;
+		spawned.reserve(batch);
+
+		auto flushBatch = [&]()
+			{
+				for (auto& go : spawned)
+					Object::Destroy(go);
+				spawned.clear();
+				FlushDestroy();
+			};
+
+		// 캐시 없이 (플랜 생성 + 실행)
+		double uncachedMs = 0.0;
+		for (size_t i = 0; i < uncachedCount; ++i)
+		{
+			Object::ClearInstantiateCache();
+			uncachedMs += MeasureMs([&]() { spawned.push_back(Object::Instantiate(prefab)); });
+			if (spawned.size() >= batch)
+				flushBatch();
+		}
+		flushBatch();
+
+		// 스크립트가 빠지거나 참조가 원본을 가리키면 플랜 측정이 의미 없으므로 먼저 확인
+		{
+			bool cloned = false;
+			auto probe = Object::Instantiate(prefab);
+			if (probe.IsValid())
+			{
+				auto script = probe->GetComponent<BenchBehaviour>();
+				cloned = script.IsValid() && script->GetTarget() == probe;
+				Object::Destroy(probe);
+			}
+			FlushDestroy();
+
+			if (!cloned)
+			{
+				_result.Skip("BenchBehaviour was not cloned with remapped references");
+				Object::ClearInstantiateCache();
+				ClearCurrentScene();
+				return;
+			}
+		}
+
+		double cachedMs = 0.0;
+		for (size_t i = 0; i < total; ++i)
+		{
+			cachedMs += MeasureMs([&]() { spawned.push_back(Object::Instantiate(prefab)); });
+			if (spawned.size() >= batch)
+				flushBatch();
+		}
+		flushBatch();
+
+		_result.iterations = total;
+		_result.totalMs = cachedMs;
+		_result.AddMetric("nodesPerPrefab", static_cast<double>(nodeCount));
+		_result.AddMetric("cachedUsPerInstantiate", cachedMs * 1.0e3 / static_cast<double>(total));
+		_result.AddMetric("uncachedUsPerInstantiate", uncachedMs * 1.0e3 / static_cast<double>(uncachedCount));
+
+		Object::ClearInstantiateCache();
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/InstantiatePlan", InstantiatePlan);
+
+	// 비활성 스크립트가 잔뜩 있는 씬에서 소수만 켜고 끌 때 프레임당 Initialize/Disable 비용
+	void InactiveBehaviourToggle(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t inactiveCount = _config.quick ? 5000 : 50000;
+		const size_t toggleCount = 16;
+		const size_t frames = _config.quick ? 100 : 1000;
+
+		auto& behaviours = BehaviourManager::Get();
+
+		auto inactiveRoot = Object::NewObject<GameObject>("BenchInactiveRoot");
+		inactiveRoot->SetActive(false);
+		for (auto& go : SpawnObjects(inactiveCount))
+		{
+			go->AddComponent<BenchBehaviour>();
+			go->GetTransform()->SetParent(inactiveRoot->GetTransform(), false);
+		}
+
+		std::vector<ObjPtr<GameObject>> toggled = SpawnObjects(toggleCount);
+		for (auto& go : toggled)
+			go->AddComponent<BenchBehaviour>();
+		behaviours.InitializeBehaviours();
+		behaviours.DisableBehaviours();
+
+		// 변화 없는 프레임
+		const double idleMs = MeasureMs([&]()
+			{
+				for (size_t f = 0; f < frames; ++f)
+				{
+					behaviours.InitializeBehaviours();
+					behaviours.DisableBehaviours();
+				}
+			});
+
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t f = 0; f < frames; ++f)
+				{
+					const bool active = (f & 1) != 0;
+					for (auto& go : toggled)
+						go->SetActive(active);
+					behaviours.InitializeBehaviours();
+					behaviours.DisableBehaviours();
+				}
+			});
+
+		_result.iterations = frames;
+		_result.AddMetric("inactiveScripts", static_cast<double>(inactiveCount));
+		_result.AddMetric("toggledPerFrame", static_cast<double>(toggleCount));
+		_result.AddMetric("idleUsPerFrame", idleMs * 1.0e3 / static_cast<double>(frames));
+
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Core/InactiveBehaviourToggle", InactiveBehaviourToggle);
+}
+
+RTTR_REGISTRATION
+{
+	using namespace rttr;
+
+	registration::class_<BenchBehaviour>("BenchBehaviour")
+		(rttr::metadata("wrapper_type_name", "ObjPtr<BenchBehaviour>"))
+		.property("Speed", &BenchBehaviour::GetSpeed, &BenchBehaviour::SetSpeed)
+		.property("Target", &BenchBehaviour::GetTarget, &BenchBehaviour::SetTarget);
+
+	registration::class_<ObjPtr<BenchBehaviour>>("ObjPtr<BenchBehaviour>")
+		.constructor([]() { return Object::NewObject<BenchBehaviour>(); })
+		.method("Inject", &ObjPtr<BenchBehaviour>::Inject);
+}
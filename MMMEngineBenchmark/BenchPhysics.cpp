@@ -0,0 +1,368 @@
+﻿#include "Benchmark.h"
+#include "GameObject.h"
+#include "Transform.h"
+#include "PhysxManager.h"
+#include "PhysicsFilter.h"
+#include "PhysicsMeshCache.h"
+#include "BoxColliderComponent.h"
+#include "RigidBodyComponent.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace MMMEngine;
+using namespace MMMEngine::Benchmark;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+	constexpr float kFixedDt = 1.0f / 60.0f;
+	constexpr float kBodySpacing = 1.5f;
+
+	ObjPtr<GameObject> SpawnBox(const Vector3& _pos, const Vector3& _halfExtents, bool _static)
+	{
+		auto go = Object::NewObject<GameObject>("BenchBody");
+		go->GetTransform()->SetWorldPosition(_pos);
+		auto rb = go->AddComponent<RigidBodyComponent>();
+		if (_static)
+			rb->SetType(RigidBodyComponent::Type::Static);
+		auto box = go->AddComponent<BoxColliderComponent>();
+		box->SetHalfExtents(_halfExtents);
+		return go;
+	}
+
+	// 원점 중심 XZ 격자에 상자 _count 개 + 바닥 (반환값 : 격자 한변 길이의 절반)
+	float SpawnBodyGrid(size_t _count, bool _static)
+	{
+		const size_t side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(_count))));
+		const float halfSize = side * kBodySpacing * 0.5f;
+
+		SpawnBox({ 0.0f, -0.5f, 0.0f }, { halfSize + 5.0f, 0.5f, halfSize + 5.0f }, true);
+		for (size_t i = 0; i < _count; ++i)
+		{
+			const float x = (i % side) * kBodySpacing - halfSize;
+			const float z = (i / side) * kBodySpacing - halfSize;
+			SpawnBox({ x, 2.0f, z }, { 0.5f, 0.5f, 0.5f }, _static);
+		}
+		return halfSize;
+	}
+
+	void StepOnce()
+	{
+		auto& physics = PhysxManager::Get();
+		physics.SetStep();
+		physics.StepFixed(kFixedDt);
+		physics.SyncStep();
+	}
+
+	// 스크립트 Update/LateUpdate 대신 메인 스레드를 일정 시간 점유
+	void SpinFor(double _ms)
+	{
+		const auto start = BenchClock::now();
+		while (ElapsedMs(start) < _ms) {}
+	}
+
+	void CollisionMatrixFilter(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t pairs = _config.quick ? 1000000 : 10000000;
+
+		CollisionMatrix matrix;
+		matrix.ResetAll(true);
+		std::mt19937 rng(1234);
+		for (uint32_t a = 0; a < CollisionMatrix::kMaxLayers; ++a)
+			for (uint32_t b = a; b < CollisionMatrix::kMaxLayers; ++b)
+				matrix.SetCanCollide(a, b, (rng() & 3) != 0);
+
+		// 레이어 쌍과 필터 데이터는 미리 만들어둠 (shape 생성 시점에 한번 계산되는 값)
+		std::vector<std::pair<uint32_t, uint32_t>> layerPairs(4096);
+		std::vector<std::pair<physx::PxFilterData, physx::PxFilterData>> filterPairs(layerPairs.size());
+		for (size_t i = 0; i < layerPairs.size(); ++i)
+		{
+			layerPairs[i] = { rng() % CollisionMatrix::kMaxLayers, rng() % CollisionMatrix::kMaxLayers };
+			filterPairs[i] = { matrix.MakeSimFilter(layerPairs[i].first), matrix.MakeSimFilter(layerPairs[i].second) };
+		}
+
+		uint64_t allowed = 0;
+		const double matrixMs = MeasureMs([&]()
+			{
+				for (size_t i = 0; i < pairs; ++i)
+				{
+					const auto& [a, b] = layerPairs[i & (layerPairs.size() - 1)];
+					allowed += matrix.CanCollide(a, b) ? 1 : 0;
+				}
+			});
+
+		// PhysX가 pair 마다 호출하는 필터 셰이더
+		const physx::PxFilterObjectAttributes attributes = physx::PxFilterObjectType::eRIGID_DYNAMIC;
+		uint64_t passed = 0;
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t i = 0; i < pairs; ++i)
+				{
+					const auto& [fd0, fd1] = filterPairs[i & (filterPairs.size() - 1)];
+					physx::PxPairFlags flags;
+					if (!(CustomFilterShader(attributes, fd0, attributes, fd1, flags, nullptr, 0) & physx::PxFilterFlag::eSUPPRESS))
+						++passed;
+				}
+			});
+		DoNotOptimize(allowed + passed);
+
+		_result.iterations = pairs;
+		_result.AddMetric("canCollideNsPerPair", matrixMs * 1.0e6 / pairs);
+		_result.AddMetric("passRatio", static_cast<double>(passed) / pairs);
+	}
+	MMM_BENCHMARK("Physics/CollisionMatrixFilter", CollisionMatrixFilter);
+
+	void SpawnColliders(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 2000 : 20000;
+		ResetPhysicsScene();
+
+		// 컴포넌트 추가 (명령 큐 적재) 와 SetStep 에서의 일괄 반영을 나눠서 측정
+		const double spawnMs = MeasureMs([&]() { SpawnBodyGrid(count, false); });
+		const double flushMs = MeasureMs([&]() { PhysxManager::Get().SetStep(); });
+		const double removeMs = MeasureMs([&]() { ResetPhysicsScene(); });
+
+		_result.iterations = count;
+		_result.totalMs = spawnMs + flushMs;
+		_result.AddMetric("colliders", static_cast<double>(count));
+		_result.AddMetric("spawnMs", spawnMs);
+		_result.AddMetric("flushMs", flushMs);
+		_result.AddMetric("removeMs", removeMs);
+	}
+	MMM_BENCHMARK("Physics/SpawnColliders", SpawnColliders);
+
+	void RunStepBenchmark(const BenchConfig& _config, BenchResult& _result, physx::PxBroadPhaseType::Enum _type)
+	{
+		const size_t count = _config.quick ? 2000 : 50000;
+		const size_t steps = _config.quick ? 30 : 120;
+		const physx::PxBounds3 bounds(physx::PxVec3(-1000.f), physx::PxVec3(1000.f));
+
+		auto& physics = PhysxManager::Get();
+		physics.SetBroadPhase(_type, bounds, 8);
+		ResetPhysicsScene();
+
+		SpawnBodyGrid(count, false);
+		const double registerMs = MeasureMs([&]() { physics.SetStep(); });
+
+		physics.SetStepProfiling(true);
+		double collisionMs = 0.0;
+		double solverMs = 0.0;
+		uint64_t contactPairs = 0;
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t s = 0; s < steps; ++s)
+				{
+					StepOnce();
+					const auto& stats = physics.GetStepStats();
+					collisionMs += stats.collisionMs;
+					solverMs += stats.solverMs;
+					contactPairs += stats.contactPairs;
+				}
+			});
+		physics.SetStepProfiling(false);
+
+		_result.iterations = steps;
+		_result.AddMetric("bodies", static_cast<double>(count));
+		_result.AddMetric("registerMs", registerMs);
+		_result.AddMetric("collisionMsPerStep", collisionMs / steps);
+		_result.AddMetric("solverMsPerStep", solverMs / steps);
+		_result.AddMetric("contactPairsPerStep", static_cast<double>(contactPairs) / steps);
+		_result.AddMetric("outOfBounds", static_cast<double>(physics.GetStepStats().outOfBounds));
+
+		// 기본 브로드페이즈로 되돌림
+		physics.SetBroadPhase(physx::PxBroadPhaseType::ePABP, bounds, 8);
+		ResetPhysicsScene();
+	}
+
+	void StepPABP(const BenchConfig& _config, BenchResult& _result) { RunStepBenchmark(_config, _result, physx::PxBroadPhaseType::ePABP); }
+	void StepABP(const BenchConfig& _config, BenchResult& _result) { RunStepBenchmark(_config, _result, physx::PxBroadPhaseType::eABP); }
+	void StepMBP(const BenchConfig& _config, BenchResult& _result) { RunStepBenchmark(_config, _result, physx::PxBroadPhaseType::eMBP); }
+	MMM_BENCHMARK("Physics/Step/PABP", StepPABP);
+	MMM_BENCHMARK("Physics/Step/ABP", StepABP);
+	MMM_BENCHMARK("Physics/Step/MBP", StepMBP);
+
+	void AsyncStepOverlap(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 2000 : 10000;
+		const size_t frames = _config.quick ? 30 : 120;
+		const double scriptMs = 2.0;
+
+		auto& physics = PhysxManager::Get();
+		ResetPhysicsScene();
+		SpawnBodyGrid(count, false);
+		StepOnce();
+
+		// 동기 : 스텝이 끝난 뒤 스크립트 실행
+		const double syncMs = MeasureMs([&]()
+			{
+				for (size_t f = 0; f < frames; ++f)
+				{
+					StepOnce();
+					SpinFor(scriptMs);
+				}
+			});
+
+		// 비동기 : 스텝을 걸어두고 스크립트와 겹쳐 실행 후 동기화
+		physics.SetAsyncStep(true);
+		const double asyncMs = MeasureMs([&]()
+			{
+				for (size_t f = 0; f < frames; ++f)
+				{
+					physics.SetStep();
+					physics.StepFixed(kFixedDt);
+					SpinFor(scriptMs);
+					physics.SyncStep();
+				}
+			});
+		physics.SetAsyncStep(false);
+
+		_result.iterations = frames;
+		_result.totalMs = asyncMs;
+		_result.AddMetric("bodies", static_cast<double>(count));
+		_result.AddMetric("scriptMsPerFrame", scriptMs);
+		_result.AddMetric("syncMsPerFrame", syncMs / frames);
+		_result.AddMetric("asyncMsPerFrame", asyncMs / frames);
+		_result.AddMetric("overlapSavedMsPerFrame", (syncMs - asyncMs) / frames);
+
+		ResetPhysicsScene();
+	}
+	MMM_BENCHMARK("Physics/AsyncStepOverlap", AsyncStepOverlap);
+
+	void SceneQueries(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 2000 : 20000;
+		const size_t queryCount = _config.quick ? 2000 : 20000;
+
+		auto& physics = PhysxManager::Get();
+		ResetPhysicsScene();
+		const float halfSize = SpawnBodyGrid(count, true);
+		StepOnce();
+
+		// 격자 위에서 아래로 쏘는 레이 (절반 정도는 상자 사이로 빠져서 바닥에 맞음)
+		std::mt19937 rng(42);
+		std::uniform_real_distribution<float> dist(-halfSize, halfSize);
+		std::vector<RaycastQuery> queries(queryCount);
+		for (auto& q : queries)
+		{
+			q.origin = { dist(rng), 20.0f, dist(rng) };
+			q.direction = { 0.0f, -1.0f, 0.0f };
+			q.maxDistance = 50.0f;
+		}
+
+		size_t singleHits = 0;
+		const double singleMs = MeasureMs([&]()
+			{
+				QueryHit hit;
+				for (const auto& q : queries)
+					if (physics.Raycast(q.origin, q.direction, q.maxDistance, hit, q.layerMask))
+						++singleHits;
+			});
+
+		std::vector<QueryHit> hits;
+		_result.totalMs = MeasureMs([&]() { physics.RaycastBatch(queries, hits); });
+
+		size_t batchHits = 0;
+		for (const auto& hit : hits)
+			if (hit.collider.IsValid())
+				++batchHits;
+
+		// 마스크 0 (충돌 대상이 없는 레이어의 GetQueryMaskForLayer 결과)은 아무것도 맞으면 안됨
+		// PhysX는 0 필터를 "필터 없음"으로 보므로 전 레이어가 맞으면 측정 자체가 잘못된 것
+		size_t zeroMaskHits = 0;
+		{
+			QueryHit hit;
+			if (physics.Raycast(queries[0].origin, queries[0].direction, queries[0].maxDistance, hit, 0))
+				++zeroMaskHits;
+
+			const QueryShape box = QueryShape::Box({ halfSize, 5.0f, halfSize });
+			if (physics.Sweep(box, { 0.0f, 20.0f, 0.0f }, Quaternion::Identity, { 0.0f, -1.0f, 0.0f }, 50.0f, hit, 0))
+				++zeroMaskHits;
+
+			std::vector<ObjPtr<ColliderComponent>> overlapped;
+			zeroMaskHits += physics.Overlap(box, { 0.0f, 0.0f, 0.0f }, Quaternion::Identity, overlapped, 0);
+
+			std::vector<RaycastQuery> zeroQueries(queries.begin(), queries.begin() + std::min<size_t>(queries.size(), 64));
+			for (auto& q : zeroQueries)
+				q.layerMask = 0;
+			std::vector<QueryHit> zeroHits;
+			physics.RaycastBatch(zeroQueries, zeroHits);
+			for (const auto& zeroHit : zeroHits)
+				if (zeroHit.collider.IsValid())
+					++zeroMaskHits;
+		}
+		if (zeroMaskHits > 0)
+		{
+			_result.Skip("queries with layerMask 0 returned hits");
+			ResetPhysicsScene();
+			return;
+		}
+
+		_result.iterations = queryCount;
+		_result.AddMetric("colliders", static_cast<double>(count + 1));
+		_result.AddMetric("batchQueriesPerSec", _result.totalMs > 0.0 ? queryCount * 1000.0 / _result.totalMs : 0.0);
+		_result.AddMetric("singleQueriesPerSec", singleMs > 0.0 ? queryCount * 1000.0 / singleMs : 0.0);
+		_result.AddMetric("batchHits", static_cast<double>(batchHits));
+		_result.AddMetric("singleHits", static_cast<double>(singleHits));
+
+		ResetPhysicsScene();
+	}
+	MMM_BENCHMARK("Physics/SceneQueries", SceneQueries);
+
+	void MeshCookVsLoad(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t side = _config.quick ? 32 : 128;
+
+		// 높이가 있는 격자 (평면이면 convex 쿠킹이 실패함)
+		MeshData data;
+		data.vertices.emplace_back();
+		data.indices.emplace_back();
+		for (size_t z = 0; z < side; ++z)
+		{
+			for (size_t x = 0; x < side; ++x)
+			{
+				Mesh_Vertex v;
+				v.Pos = { static_cast<float>(x), std::sin(x * 0.3f) * std::cos(z * 0.3f) * 2.0f, static_cast<float>(z) };
+				data.vertices[0].push_back(v);
+			}
+		}
+		for (size_t z = 0; z + 1 < side; ++z)
+		{
+			for (size_t x = 0; x + 1 < side; ++x)
+			{
+				const UINT i0 = static_cast<UINT>(z * side + x);
+				const UINT i2 = i0 + static_cast<UINT>(side);
+				data.indices[0].insert(data.indices[0].end(), { i0, i2, i0 + 1, i0 + 1, i2, i2 + 1 });
+			}
+		}
+
+		auto& cache = PhysicsMeshCache::Get();
+		const uint64_t hash = PhysicsMeshCache::ComputeHash(data);
+
+		// 벤치마크 데이터 폴더는 실행마다 비워지므로 첫 호출은 항상 쿠킹
+		cache.ResetStats();
+		cache.CookToCache(hash, data);
+		const PhysicsMeshCacheStats cookStats = cache.GetStats();
+
+		// 메모리 캐시를 비우고 디스크 캐시에서 역직렬화
+		cache.ShutDown();
+		cache.ResetStats();
+		const bool loaded = cache.GetConvexMesh(hash) && cache.GetTriangleMesh(hash);
+		const PhysicsMeshCacheStats loadStats = cache.GetStats();
+		cache.ShutDown();
+
+		if (!loaded || cookStats.cookCount == 0)
+		{
+			_result.Skip("mesh cooking or cache load failed");
+			return;
+		}
+
+		_result.iterations = loadStats.loadCount;
+		_result.totalMs = loadStats.loadMs;
+		_result.AddMetric("triangles", static_cast<double>(data.indices[0].size() / 3));
+		_result.AddMetric("cookMs", cookStats.cookMs);
+		_result.AddMetric("loadMs", loadStats.loadMs);
+		_result.AddMetric("cookToLoadRatio", loadStats.loadMs > 0.0 ? cookStats.cookMs / loadStats.loadMs : 0.0);
+	}
+	MMM_BENCHMARK("Physics/MeshCookVsLoad", MeshCookVsLoad);
+}
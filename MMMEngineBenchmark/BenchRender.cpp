@@ -0,0 +1,193 @@
+﻿#include "Benchmark.h"
+#include "GameObject.h"
+#include "Transform.h"
+#include "RenderManager.h"
+#include "RenderBackend.h"
+#include "RendererTools.h"
+#include "ShaderInfo.h"
+#include "MeshRenderer.h"
+#include "StaticMesh.h"
+#include "Material.h"
+
+using namespace MMMEngine;
+using namespace MMMEngine::Benchmark;
+using DirectX::SimpleMath::Matrix;
+
+namespace
+{
+	void TransformSlots(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 10000 : 100000;
+		const size_t rounds = _config.quick ? 20 : 100;
+
+		std::vector<Matrix> worlds(count);
+		std::vector<Matrix> cachedWorlds(count);
+		std::vector<Render_TransformSlot> slots(count);
+		for (size_t i = 0; i < count; ++i)
+			worlds[i] = Matrix::CreateRotationY(i * 0.01f) * Matrix::CreateTranslation(static_cast<float>(i), 0.0f, 0.0f);
+
+		// 매 프레임 전부 바뀐 경우 (캐시 무효)
+		size_t recomputed = 0;
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+					recomputed += BatchTransformSlots(worlds.data(), cachedWorlds.data(), slots.data(), count, 0);
+			});
+
+		// 전부 그대로인 경우 (비교만 하고 건너뜀)
+		size_t skippedRecompute = 0;
+		const double cachedMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+					skippedRecompute += BatchTransformSlots(worlds.data(), cachedWorlds.data(), slots.data(), count, count);
+			});
+		DoNotOptimize(recomputed + skippedRecompute);
+
+		_result.iterations = count * rounds;
+		_result.AddMetric("slots", static_cast<double>(count));
+		_result.AddMetric("cachedNsPerSlot", cachedMs * 1.0e6 / static_cast<double>(count * rounds));
+		_result.AddMetric("cachedRecomputed", static_cast<double>(skippedRecompute));
+	}
+	MMM_BENCHMARK("Render/BatchTransformSlots", TransformSlots);
+
+	void PropertyLookup(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t draws = _config.quick ? 100000 : 1000000;
+
+		auto& renderer = RenderManager::Get();
+		ID3D11DeviceContext4* context = renderer.GetContext().Get();
+		// 헤드리스면 셰이더 리플렉션이 없어서 테이블 확인에서 멈춤 -> 조회 비용만 측정됨
+		if (!context && !renderer.IsHeadless())
+		{
+			_result.Skip("no device context");
+			return;
+		}
+
+		const std::vector<std::wstring> names = {
+			L"_albedo", L"_normal", L"_emissive", L"_shadowmap", L"_opacity", L"_specular", L"_irradiance", L"_brdflut",
+			L"_metallic", L"_roughness", L"_ambientOcclusion", L"mBaseColor", L"mMetallic", L"mRoughness", L"mAoStrength", L"mLightColor" };
+
+		auto material = std::make_shared<Material>();
+		for (size_t i = 0; i < names.size(); ++i)
+			material->AddProperty(names[i], static_cast<float>(i));
+
+		auto& shaderInfo = ShaderInfo::Get();
+		const ShaderType type = shaderInfo.GetShaderType(material->GetPShader().get());
+
+		// BakeMaterial 이 메테리얼 버전마다 만드는 것과 같은 (핸들, 값) 목록
+		std::vector<std::pair<PropertyHandle, const PropertyValue*>> handles;
+		for (const auto& [name, value] : material->GetProperties())
+			handles.emplace_back(shaderInfo.GetPropertyHandle(name), &value);
+
+		// 예전 드로우 경로 : 프로퍼티마다 이름으로 UpdateProperty (wstring 해시 + 비교)
+		const double nameMs = MeasureMs([&]()
+			{
+				for (size_t d = 0; d < draws; ++d)
+					for (const auto& [name, value] : material->GetProperties())
+						shaderInfo.UpdateProperty(context, type, name, &value);
+			});
+
+		// 핸들 경로 : 미리 풀어둔 핸들로 UpdateProperty
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t d = 0; d < draws; ++d)
+					for (const auto& [handle, value] : handles)
+						shaderInfo.UpdateProperty(context, type, handle, value);
+			});
+
+		// BakeMaterial : 매 드로우 값이 바뀌는 경우 (이름 -> 핸들 재변환) vs 버전이 같아 캐시를 쓰는 경우
+		const size_t bakes = draws / 10;
+		const double rebakeMs = MeasureMs([&]()
+			{
+				for (size_t d = 0; d < bakes; ++d)
+				{
+					material->SetProperty(names[d & 15], static_cast<float>(d));
+					DoNotOptimize(shaderInfo.BakeMaterial(context, material.get()).cbuffers.size());
+				}
+			});
+		const double cachedBakeMs = MeasureMs([&]()
+			{
+				for (size_t d = 0; d < bakes; ++d)
+					DoNotOptimize(shaderInfo.BakeMaterial(context, material.get()).cbuffers.size());
+			});
+
+		const double updates = static_cast<double>(draws * handles.size());
+		_result.iterations = draws * handles.size();
+		_result.AddMetric("nameUpdateNsPerOp", nameMs * 1.0e6 / updates);
+		_result.AddMetric("speedup", _result.totalMs > 0.0 ? nameMs / _result.totalMs : 0.0);
+		_result.AddMetric("rebakeNsPerMaterial", rebakeMs * 1.0e6 / static_cast<double>(bakes));
+		_result.AddMetric("cachedBakeNsPerMaterial", cachedBakeMs * 1.0e6 / static_cast<double>(bakes));
+	}
+	MMM_BENCHMARK("Render/PropertyLookup", PropertyLookup);
+
+	// 셰이더 없는 메테리얼 + 빈 GPU 버퍼 : 널 백엔드에서 커맨드 생성/정렬/실행 경로만 탐
+	ResPtr<StaticMesh> CreateDummyMesh()
+	{
+		auto mesh = std::make_shared<StaticMesh>();
+		mesh->gpuBuffer.vertexBuffers.resize(1);
+		mesh->gpuBuffer.indexBuffers.resize(1);
+		mesh->indexSizes = { 36 };
+		mesh->materials = { std::make_shared<Material>() };
+		mesh->meshGroupData[0] = { 0 };
+		return mesh;
+	}
+
+	double RenderFrames(size_t _frames)
+	{
+		auto& renderer = RenderManager::Get();
+		return MeasureMs([&]()
+			{
+				for (size_t f = 0; f < _frames; ++f)
+				{
+					renderer.BeginFrame();
+					renderer.Render();
+					renderer.EndFrame();
+				}
+			});
+	}
+
+	void CommandGeneration(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 2000 : 20000;
+		const size_t frames = _config.quick ? 20 : 100;
+
+		auto& renderer = RenderManager::Get();
+		RenderBackend* backend = renderer.GetBackend();
+		if (!renderer.IsHeadless() || !backend)
+		{
+			_result.Skip("RenderManager is not running headless");
+			return;
+		}
+
+		auto mesh = CreateDummyMesh();
+		for (size_t i = 0; i < count; ++i)
+		{
+			auto go = Object::NewObject<GameObject>("BenchRenderer");
+			go->GetTransform()->SetLocalPosition(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100));
+			go->AddComponent<MeshRenderer>()->SetMesh(mesh);
+		}
+		RenderFrames(1);
+
+		// 직렬 생성
+		const size_t threshold = renderer.GetParallelRenderThreshold();
+		renderer.SetParallelRenderThreshold(SIZE_MAX);
+		const double serialMs = RenderFrames(frames);
+
+		// 워커 병렬 생성
+		renderer.SetParallelRenderThreshold(threshold);
+		backend->ResetStats();
+		_result.totalMs = RenderFrames(frames);
+		const RenderBackendStats stats = backend->GetStats();
+
+		_result.iterations = count * frames;
+		_result.AddMetric("renderers", static_cast<double>(count));
+		_result.AddMetric("serialMsPerFrame", serialMs / frames);
+		_result.AddMetric("parallelMsPerFrame", _result.totalMs / frames);
+		_result.AddMetric("drawCallsPerFrame", static_cast<double>(stats.drawCalls) / frames);
+		_result.AddMetric("transformBindsPerFrame", static_cast<double>(stats.transformBinds) / frames);
+		_result.AddMetric("uploadedBytesPerFrame", static_cast<double>(stats.uploadedBytes) / frames);
+
+		ClearCurrentScene();
+	}
+	MMM_BENCHMARK("Render/CommandGeneration", CommandGeneration);
+}
@@ -0,0 +1,148 @@
+﻿#include "Benchmark.h"
+#include "GameObject.h"
+#include "Transform.h"
+#include "SceneManager.h"
+#include "SceneSerializer.h"
+#include "StaticMesh.h"
+#include "ResourceSerializer.h"
+#include <filesystem>
+
+using namespace MMMEngine;
+using namespace MMMEngine::Benchmark;
+
+namespace
+{
+	// 루트 4개 중 하나 꼴로 자식을 붙인 씬 생성
+	void GenerateScene(size_t _count)
+	{
+		ObjPtr<Transform> parent = nullptr;
+		for (size_t i = 0; i < _count; ++i)
+		{
+			auto go = Object::NewObject<GameObject>("BenchObject_" + std::to_string(i));
+			go->SetLayer(static_cast<uint32_t>(i % 5));
+			go->GetTransform()->SetLocalPosition(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100));
+
+			if (i % 4 == 0)
+				parent = go->GetTransform();
+			else if (parent.IsValid())
+				go->GetTransform()->SetParent(parent, true);
+		}
+	}
+
+	void SceneRoundTrip(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t count = _config.quick ? 1000 : 10000;
+		const size_t rounds = _config.quick ? 3 : 5;
+
+		auto& sceneManager = SceneManager::Get();
+		const size_t sceneID = sceneManager.GetCurrentScene().id;
+
+		ClearCurrentScene();
+		GenerateScene(count);
+
+		// 스냅샷 크기 (에디터가 저장하는 msgpack 기준)
+		SnapShot snapshot;
+		SceneSerializer::Get().SerializeToMemory(*sceneManager.GetCurrentSceneRaw(), snapshot);
+		const size_t snapshotBytes = nlohmann::json::to_msgpack(snapshot).size();
+
+		double serializeMs = 0.0;
+		double deserializeMs = 0.0;
+		size_t restored = 0;
+		for (size_t r = 0; r < rounds; ++r)
+		{
+			// 씬 -> 스냅샷
+			serializeMs += MeasureMs([&]() { sceneManager.ReloadSnapShotCurrentScene(); });
+
+			// 스냅샷 -> 씬 (씬 재로드 경로 그대로 : 기존 오브젝트 파괴 + 역직렬화)
+			deserializeMs += MeasureMs([&]()
+				{
+					sceneManager.ChangeScene(sceneID);
+					sceneManager.CheckSceneIsChanged();
+					FlushDestroy();
+				});
+			restored = sceneManager.GetAllGameObjectInCurrentScene().size();
+		}
+
+		_result.iterations = count * rounds;
+		_result.totalMs = serializeMs + deserializeMs;
+		_result.AddMetric("objects", static_cast<double>(count));
+		_result.AddMetric("restoredObjects", static_cast<double>(restored));
+		_result.AddMetric("serializeMsPerScene", serializeMs / rounds);
+		_result.AddMetric("deserializeMsPerScene", deserializeMs / rounds);
+		_result.AddMetric("snapshotBytes", static_cast<double>(snapshotBytes));
+
+		// 다음 벤치마크가 빈 씬에서 시작하도록 빈 스냅샷으로 갱신
+		ClearCurrentScene();
+		sceneManager.ReloadSnapShotCurrentScene();
+	}
+	MMM_BENCHMARK("Serialization/SceneRoundTrip", SceneRoundTrip);
+
+	// 한변 _side 개 정점의 격자 메시 (서브메시 1개)
+	void BuildGridMesh(StaticMesh& _mesh, size_t _side)
+	{
+		std::vector<Mesh_Vertex> vertices;
+		std::vector<UINT> indices;
+		vertices.reserve(_side * _side);
+		indices.reserve((_side - 1) * (_side - 1) * 6);
+
+		for (size_t z = 0; z < _side; ++z)
+		{
+			for (size_t x = 0; x < _side; ++x)
+			{
+				Mesh_Vertex v;
+				v.Pos = { static_cast<float>(x), 0.0f, static_cast<float>(z) };
+				v.Normal = { 0.0f, 1.0f, 0.0f };
+				v.Tangent = { 1.0f, 0.0f, 0.0f };
+				v.UV = { static_cast<float>(x) / (_side - 1), static_cast<float>(z) / (_side - 1) };
+				vertices.push_back(v);
+			}
+		}
+
+		for (size_t z = 0; z + 1 < _side; ++z)
+		{
+			for (size_t x = 0; x + 1 < _side; ++x)
+			{
+				const UINT i0 = static_cast<UINT>(z * _side + x);
+				const UINT i1 = i0 + 1;
+				const UINT i2 = i0 + static_cast<UINT>(_side);
+				const UINT i3 = i2 + 1;
+				indices.insert(indices.end(), { i0, i2, i1, i1, i2, i3 });
+			}
+		}
+
+		_mesh.meshData.vertices.push_back(std::move(vertices));
+		_mesh.meshData.indices.push_back(std::move(indices));
+		_mesh.meshGroupData[0] = { 0 };
+	}
+
+	void StaticMeshLoad(const BenchConfig& _config, BenchResult& _result)
+	{
+		const size_t side = _config.quick ? 64 : 256;
+		const size_t rounds = _config.quick ? 3 : 10;
+
+		StaticMesh source;
+		BuildGridMesh(source, side);
+		const std::filesystem::path path = ResourceSerializer::Get().Serialize_StaticMesh(&source, L"Benchmark", L"Grid");
+
+		size_t loadedVertices = 0;
+		_result.totalMs = MeasureMs([&]()
+			{
+				for (size_t r = 0; r < rounds; ++r)
+				{
+					StaticMesh loaded;
+					ResourceSerializer::Get().DeSerialize_StaticMesh(&loaded, path.wstring());
+					loadedVertices = loaded.meshData.vertices.empty() ? 0 : loaded.meshData.vertices[0].size();
+				}
+			});
+
+		std::error_code ec;
+		const auto fileBytes = std::filesystem::file_size(path, ec);
+
+		_result.iterations = rounds;
+		_result.AddMetric("vertices", static_cast<double>(side * side));
+		_result.AddMetric("loadedVertices", static_cast<double>(loadedVertices));
+		_result.AddMetric("fileBytes", ec ? 0.0 : static_cast<double>(fileBytes));
+		_result.AddMetric("msPerLoad", _result.totalMs / rounds);
+	}
+	MMM_BENCHMARK("Serialization/StaticMeshLoad", StaticMeshLoad);
+}
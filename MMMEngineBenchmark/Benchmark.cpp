@@ -0,0 +1,46 @@
+﻿#include "Benchmark.h"
+#include "SceneManager.h"
+#include "ObjectManager.h"
+#include "BehaviourManager.h"
+#include "PhysxManager.h"
+
+namespace MMMEngine::Benchmark
+{
+	std::vector<BenchEntry>& GetRegistry()
+	{
+		static std::vector<BenchEntry> registry;
+		return registry;
+	}
+
+	void DoNotOptimize(uint64_t _value)
+	{
+		static volatile uint64_t sink = 0;
+		sink = sink + _value;
+	}
+
+	void FlushDestroy()
+	{
+		ObjectManager::Get().UpdateInternalTimer(0.0f);
+		BehaviourManager::Get().DisableBehaviours();
+		ObjectManager::Get().FlushPendingDestroy();
+	}
+
+	void ClearCurrentScene()
+	{
+		for (auto& go : SceneManager::Get().GetAllGameObjectInCurrentScene())
+		{
+			if (go.IsValid() && !go->IsDestroyed())
+				Object::Destroy(go);
+		}
+		FlushDestroy();
+	}
+
+	void ResetPhysicsScene()
+	{
+		// 파괴된 콜라이더/리지드 해제 명령을 먼저 반영한 뒤 PxScene을 새로 만듦
+		ClearCurrentScene();
+		PhysxManager::Get().SetStep();
+		PhysxManager::Get().UnbindScene();
+		PhysxManager::Get().BindScene(SceneManager::Get().GetCurrentSceneRaw());
+	}
+}
@@ -0,0 +1,76 @@
+﻿#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MMMEngine::Benchmark
+{
+	struct BenchConfig
+	{
+		bool quick = false;			// 작은 규모로 빠르게 (CI/스모크용)
+		std::string filter;			// 이름에 포함된 벤치마크만 실행 (비어있으면 전부)
+	};
+
+	// 벤치마크 하나의 결과
+	// iterations 는 측정한 연산 수 (오브젝트 수 x 반복 등), nsPerOp = totalMs / iterations
+	struct BenchResult
+	{
+		std::string name;
+		uint64_t iterations = 0;
+		double totalMs = 0.0;
+		bool skipped = false;
+		std::string note;
+		std::vector<std::pair<std::string, double>> metrics;	// 부가 수치 (등록 순서 유지)
+
+		void AddMetric(const std::string& _key, double _value) { metrics.emplace_back(_key, _value); }
+		void Skip(const std::string& _reason) { skipped = true; note = _reason; }
+		double NsPerOp() const { return iterations ? totalMs * 1.0e6 / static_cast<double>(iterations) : 0.0; }
+	};
+
+	using BenchFunc = void(*)(const BenchConfig&, BenchResult&);
+
+	struct BenchEntry
+	{
+		const char* name;
+		BenchFunc func;
+	};
+
+	// 정적 초기화로 채워지는 목록 (번역단위 사이 순서는 보장 안되므로 실행 전에 이름순으로 정렬함)
+	std::vector<BenchEntry>& GetRegistry();
+
+	struct BenchRegistrar
+	{
+		BenchRegistrar(const char* _name, BenchFunc _func) { GetRegistry().push_back({ _name, _func }); }
+	};
+
+	using BenchClock = std::chrono::steady_clock;
+
+	inline double ElapsedMs(BenchClock::time_point _start)
+	{
+		return std::chrono::duration<double, std::milli>(BenchClock::now() - _start).count();
+	}
+
+	// 측정 구간 실행 후 걸린 시간(ms) 반환
+	template<typename F>
+	double MeasureMs(F&& _func)
+	{
+		const auto start = BenchClock::now();
+		_func();
+		return ElapsedMs(start);
+	}
+
+	// 최적화로 결과가 버려지지 않게 값을 붙잡아둠
+	void DoNotOptimize(uint64_t _value);
+
+	// 현재 씬의 게임오브젝트를 전부 파괴하고 파괴 대기열까지 처리
+	void ClearCurrentScene();
+	// 메인루프 끝과 같은 순서로 파괴 대기열 처리 (삭제 예산 무시하고 전부)
+	void FlushDestroy();
+	// 물리 명령 큐 반영 + 씬을 새로 만들어서 이전 벤치마크의 상태를 지움
+	void ResetPhysicsScene();
+}
+
+#define MMM_BENCHMARK(_name, _func) \
+	static ::MMMEngine::Benchmark::BenchRegistrar s_benchRegistrar_##_func(_name, &_func)
@@ -0,0 +1,217 @@
+﻿#define NOMINMAX
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <algorithm>
+#include <ctime>
+
+#include "Benchmark.h"
+
+#include "ResourceManager.h"
+#include "RenderManager.h"
+#include "JobSystem.h"
+#include "BehaviourManager.h"
+#include "SceneManager.h"
+#include "ObjectManager.h"
+#include "PhysxManager.h"
+#include "PhysicsMeshCache.h"
+#include "Profiler.h"
+#include "json/json.hpp"
+
+namespace fs = std::filesystem;
+using namespace MMMEngine;
+using namespace MMMEngine::Benchmark;
+
+// 창/GPU 없이 엔진 코어 시스템만 올려서 측정하는 벤치마크 실행파일
+// MMMEngineBenchmark.exe [--quick] [--filter <이름 일부>] [--out <json 경로>] [--label <커밋 등 식별자>] [--list]
+// 결과는 json 으로 저장 (기본 Benchmark/results.json) -> 커밋별로 모아서 회귀 추적용
+
+namespace
+{
+	// 벤치마크용 리소스 루트 (쿠킹 캐시, 직렬화 파일) //실행마다 비움
+	fs::path GetDataRoot()
+	{
+		return fs::current_path() / "Benchmark" / "Data";
+	}
+
+	void Initialize()
+	{
+		Profiler::Get().StartUp();
+		Profiler::Get().SetThreadName("Main");
+		Profiler::Get().SetEnabled(false);
+
+		const fs::path dataRoot = GetDataRoot();
+		std::error_code ec;
+		fs::remove_all(dataRoot, ec);
+		fs::create_directories(dataRoot, ec);
+
+		JobSystem::Get().StartUp();
+		RenderManager::Get().StartUpHeadless(1920, 1080);
+
+		ResourceManager::Get().StartUp(dataRoot.generic_wstring() + L"/");
+
+		// 씬 리스트가 없으면 빈 씬 하나로 시작
+		SceneManager::Get().StartUp(dataRoot.generic_wstring() + L"/Scenes", 0, true);
+		ObjectManager::Get().StartUp();
+
+		PhysicX::Get().Initialize();
+
+		SceneManager::Get().CheckSceneIsChanged();
+		PhysxManager::Get().BindScene(SceneManager::Get().GetCurrentSceneRaw());
+
+		// 기본 오브젝트(카메라)까지 지워서 빈 씬에서 시작
+		ClearCurrentScene();
+		SceneManager::Get().ReloadSnapShotCurrentScene();
+	}
+
+	void Release()
+	{
+		PhysxManager::Get().UnbindScene();
+		RenderManager::Get().ShutDown();
+		JobSystem::Get().ShutDown();
+
+		SceneManager::Get().ShutDown();
+		PhysicsMeshCache::Get().ShutDown();
+		ObjectManager::Get().ShutDown();
+		BehaviourManager::Get().ShutDown();
+		ResourceManager::Get().ShutDown();
+
+		Profiler::Get().ShutDown();
+
+		std::error_code ec;
+		fs::remove_all(GetDataRoot(), ec);
+	}
+
+	nlohmann::json ToJson(const BenchResult& _result)
+	{
+		nlohmann::json j;
+		j["name"] = _result.name;
+		j["skipped"] = _result.skipped;
+		if (!_result.note.empty())
+			j["note"] = _result.note;
+		j["iterations"] = _result.iterations;
+		j["totalMs"] = _result.totalMs;
+		j["nsPerOp"] = _result.NsPerOp();
+
+		nlohmann::json metrics = nlohmann::json::object();
+		for (const auto& [key, value] : _result.metrics)
+			metrics[key] = value;
+		j["metrics"] = metrics;
+		return j;
+	}
+
+	std::string GetTimeStamp()
+	{
+		std::time_t now = std::time(nullptr);
+		std::tm local{};
+		localtime_s(&local, &now);
+		char buffer[32];
+		std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &local);
+		return buffer;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BenchConfig config;
+	fs::path outPath = fs::current_path() / "Benchmark" / "results.json";
+	std::string label;
+	bool listOnly = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (arg == "--quick")
+			config.quick = true;
+		else if (arg == "--list")
+			listOnly = true;
+		else if (arg == "--filter" && hasValue)
+			config.filter = argv[++i];
+		else if (arg == "--out" && hasValue)
+			outPath = fs::u8path(argv[++i]);
+		else if (arg == "--label" && hasValue)
+			label = argv[++i];
+		else
+		{
+			std::cerr << "unknown argument : " << arg << std::endl;
+			std::cerr << "usage : MMMEngineBenchmark [--quick] [--filter <name>] [--out <path>] [--label <text>] [--list]" << std::endl;
+			return 2;
+		}
+	}
+
+	// 번역단위 사이 등록 순서는 정해져있지 않으니 이름순으로 고정
+	auto entries = GetRegistry();
+	std::sort(entries.begin(), entries.end(),
+		[](const BenchEntry& a, const BenchEntry& b) { return std::string(a.name) < b.name; });
+
+	if (listOnly)
+	{
+		for (const auto& entry : entries)
+			std::cout << entry.name << std::endl;
+		return 0;
+	}
+
+	Initialize();
+
+	std::vector<BenchResult> results;
+	for (const auto& entry : entries)
+	{
+		if (!config.filter.empty() && std::string(entry.name).find(config.filter) == std::string::npos)
+			continue;
+
+		BenchResult result;
+		result.name = entry.name;
+		try
+		{
+			entry.func(config, result);
+		}
+		catch (const std::exception& e)
+		{
+			result.Skip(std::string("exception : ") + e.what());
+		}
+
+		if (result.skipped)
+			std::cout << std::left << std::setw(36) << result.name << " skipped (" << result.note << ")" << std::endl;
+		else
+			std::cout << std::left << std::setw(36) << result.name
+				<< std::right << std::fixed << std::setprecision(2)
+				<< std::setw(14) << result.NsPerOp() << " ns/op"
+				<< std::setw(12) << result.totalMs << " ms" << std::endl;
+
+		results.push_back(std::move(result));
+	}
+
+	nlohmann::json report;
+	report["label"] = label;
+	report["timestamp"] = GetTimeStamp();
+	report["quick"] = config.quick;
+#ifdef _DEBUG
+	report["configuration"] = "Debug";
+#else
+	report["configuration"] = "Release";
+#endif
+	report["workerThreads"] = JobSystem::Get().GetWorkerCount();
+
+	nlohmann::json resultArray = nlohmann::json::array();
+	for (const auto& result : results)
+		resultArray.push_back(ToJson(result));
+	report["results"] = resultArray;
+
+	Release();
+
+	std::error_code ec;
+	if (outPath.has_parent_path())
+		fs::create_directories(outPath.parent_path(), ec);
+
+	std::ofstream file(outPath, std::ios::trunc);
+	if (!file)
+	{
+		std::cerr << "failed to write " << outPath.u8string() << std::endl;
+		return 1;
+	}
+	file << report.dump(4);
+	std::cout << "results : " << outPath.u8string() << std::endl;
+	return 0;
+}
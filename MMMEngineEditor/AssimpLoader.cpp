@@ -5,6 +5,7 @@
 #include "StaticMesh.h"
 #include "SkeletalMesh.h"
 #include "Material.h"
+#include "PhysicsMeshCache.h"
 #include "Texture2D.h"
 
 #include <rttr/registration.h>
@@ -741,7 +742,10 @@ void MMMEngine::AssimpLoader::RegisterModel(const std::wstring path, ModelType t
 	{
 	case MMMEngine::ModelType::Static:
 		staticMesh = ConvertStaticMesh(&model);
+		// 메시 콜라이더용 해시는 에셋에 저장하고 쿠킹은 임포트때 한번만 (런타임 로드때는 둘 다 안함)
+		staticMesh->collisionHash = PhysicsMeshCache::ComputeHash(staticMesh->meshData);
 		ResourceSerializer::Get().Serialize_StaticMesh(staticMesh.get(), m_exportPath, filename);
+		PhysicsMeshCache::Get().CookToCache(staticMesh->collisionHash, staticMesh->meshData);
 		break;
 	case MMMEngine::ModelType::Animated:
 		skeletalMesh = ConvertSkeletalMesh(&model);
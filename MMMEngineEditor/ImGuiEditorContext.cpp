@@ -30,6 +30,7 @@ using namespace MMMEngine::Utility;
 #include "SceneNameWindow.h"
 #include "SceneChangeWindow.h"
 #include "AssimpLoaderWindow.h"
+#include "ProfilerWindow.h"
 
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -385,6 +386,7 @@ void MMMEngine::Editor::ImGuiEditorContext::Render()
                 ImGui::MenuItem(u8"파일 뷰어", nullptr, &g_editor_window_files);
                 ImGui::MenuItem(u8"씬", nullptr, &g_editor_window_sceneView);
                 ImGui::MenuItem(u8"게임", nullptr, &g_editor_window_gameView);
+                ImGui::MenuItem(u8"프로파일러", nullptr, &g_editor_window_profiler);
                 ImGui::EndMenu();
             }
             if (ImGui::BeginMenu(u8"도구"))
@@ -736,6 +738,7 @@ void MMMEngine::Editor::ImGuiEditorContext::Render()
     PhysicsSettingsWindow::Get().Render();
     PlayerBuildWindow::Get().Render();
     AssimpLoaderWindow::Get().Render();
+    ProfilerWindow::Get().Render();
 }
 
 void MMMEngine::Editor::ImGuiEditorContext::EndFrame()
@@ -175,6 +175,26 @@ void MMMEngine::Editor::PhysicsSettingsWindow::Render()
         }
         ImGui::EndChild();
 
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Text("Broadphase (applied on next scene load)");
+
+        const char* broadPhaseNames[] = { "PABP", "ABP", "MBP" };
+        int broadPhaseIdx = static_cast<int>(settings.broadPhaseType);
+        if (ImGui::Combo("Type", &broadPhaseIdx, broadPhaseNames, IM_ARRAYSIZE(broadPhaseNames))) {
+            settings.broadPhaseType = static_cast<BroadPhaseType>(broadPhaseIdx);
+        }
+
+        // MBP만 월드 범위/영역 분할을 사용
+        if (settings.broadPhaseType == BroadPhaseType::MBP) {
+            ImGui::DragFloat3("World Min", settings.worldBoundsMin, 10.0f);
+            ImGui::DragFloat3("World Max", settings.worldBoundsMax, 10.0f);
+            int subdiv = static_cast<int>(settings.broadPhaseSubdivisions);
+            if (ImGui::SliderInt("Subdivisions", &subdiv, 1, 16)) {
+                settings.broadPhaseSubdivisions = static_cast<uint32_t>(subdiv);
+            }
+        }
+
         // 수동 적용 버튼 (선택 사항)
         if (ImGui::Button("Apply & Save Now")) {
             auto projectDir = ProjectManager::Get().GetActiveProject().ProjectRootFS();
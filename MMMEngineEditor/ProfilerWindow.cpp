@@ -0,0 +1,353 @@
+﻿#include "ProfilerWindow.h"
+#include "EditorRegistry.h"
+#include "ProjectManager.h"
+
+#include "TimeManager.h"
+#include "ObjectManager.h"
+#include "RenderManager.h"
+#include "PhysxManager.h"
+#include "ResourceManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <imgui.h>
+
+using namespace MMMEngine;
+using namespace MMMEngine::EditorRegistry;
+
+namespace
+{
+	const char* kRenderTypeNames[] =
+	{
+		"ShadowMap", "PreDepth", "Skybox", "Geometry", "Transculant",
+		"Additive", "Particle", "PostProcess", "UI", "None",
+	};
+	static_assert(sizeof(kRenderTypeNames) / sizeof(kRenderTypeNames[0]) == R_END, "RenderType 이름 개수 불일치");
+
+	std::filesystem::path MakeCapturePath()
+	{
+		const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+		std::tm local{};
+		localtime_s(&local, &now);
+
+		char name[64];
+		std::strftime(name, sizeof(name), "trace_%Y%m%d_%H%M%S.json", &local);
+
+		std::filesystem::path root = ProjectManager::Get().HasActiveProject()
+			? ProjectManager::Get().GetActiveProject().ProjectRootFS()
+			: std::filesystem::current_path();
+		return root / "Profile" / name;
+	}
+}
+
+void MMMEngine::Editor::ProfilerWindow::RecordFrameTime()
+{
+	if (m_paused) return;
+
+	m_frameTimes[m_frameOffset] = TimeManager::Get().GetUnscaledDeltaTime() * 1000.0f;
+	m_frameOffset = (m_frameOffset + 1) % kHistorySize;
+}
+
+void MMMEngine::Editor::ProfilerWindow::RenderFrameGraph()
+{
+	float sum = 0.0f;
+	float worst = 0.0f;
+	for (float ms : m_frameTimes)
+	{
+		sum += ms;
+		worst = (std::max)(worst, ms);
+	}
+	const float average = sum / static_cast<float>(kHistorySize);
+
+	char overlay[64];
+	std::snprintf(overlay, sizeof(overlay), "avg %.2f ms (%.0f fps) / max %.2f ms",
+		average, average > 0.0f ? 1000.0f / average : 0.0f, worst);
+
+	// 33ms(30fps) 기준으로 잡고 그보다 튀는 프레임은 위로 늘림
+	const float scaleMax = (std::max)(33.3f, worst * 1.1f);
+	ImGui::PlotLines("##FrameTimes", m_frameTimes.data(), static_cast<int>(kHistorySize),
+		static_cast<int>(m_frameOffset), overlay, 0.0f, scaleMax, ImVec2(-1.0f, 80.0f));
+
+	ImGui::Checkbox(u8"그래프 일시정지", &m_paused);
+
+	const FrameTimeStats stats = TimeManager::Get().GetFrameStats();
+	ImGui::Text("p50 %.2f / p95 %.2f / p99 %.2f ms", stats.p50Ms, stats.p95Ms, stats.p99Ms);
+	ImGui::Text(u8"버린 fixed step %llu (예산 초과 프레임 %u) / 시간 배율 %.2f",
+		static_cast<unsigned long long>(stats.droppedFixedSteps), stats.budgetHitFrames, stats.timeDilation);
+}
+
+void MMMEngine::Editor::ProfilerWindow::RenderZones()
+{
+	Profiler& profiler = Profiler::Get();
+
+	bool recording = profiler.IsEnabled();
+	if (ImGui::Checkbox(u8"기록", &recording))
+		profiler.SetEnabled(recording);
+
+	if (!recording)
+	{
+		ImGui::TextDisabled(u8"기록을 켜면 시스템별 시간이 표시됩니다.");
+		return;
+	}
+
+	// 지금 프레임은 아직 진행중이라 직전 프레임을 보여줌
+	const uint32_t frame = profiler.GetFrameIndex();
+	if (frame > 1 && !m_paused)
+		profiler.CollectFrameZones(frame - 1, m_zones);
+
+	const ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+		| ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp;
+	if (!ImGui::BeginTable("##ProfilerZones", 3, flags, ImVec2(0.0f, 200.0f)))
+		return;
+
+	ImGui::TableSetupScrollFreeze(0, 1);
+	ImGui::TableSetupColumn(u8"시스템", ImGuiTableColumnFlags_WidthStretch);
+	ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+	ImGui::TableSetupColumn(u8"호출", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+	ImGui::TableHeadersRow();
+
+	for (const auto& zone : m_zones)
+	{
+		ImGui::TableNextRow();
+		ImGui::TableSetColumnIndex(0);
+		ImGui::SetCursorPosX(ImGui::GetCursorPosX() + zone.depth * 12.0f);
+		ImGui::TextUnformatted(zone.name);
+		ImGui::TableSetColumnIndex(1);
+		ImGui::Text("%.3f", zone.totalMs);
+		ImGui::TableSetColumnIndex(2);
+		ImGui::Text("%u", zone.callCount);
+	}
+
+	ImGui::EndTable();
+}
+
+void MMMEngine::Editor::ProfilerWindow::RenderCounters()
+{
+	if (!ImGui::BeginTable("##ProfilerCounters", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp))
+		return;
+
+	auto row = [](const char* _label, size_t _value)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableSetColumnIndex(0);
+			ImGui::TextUnformatted(_label);
+			ImGui::TableSetColumnIndex(1);
+			ImGui::Text("%zu", _value);
+		};
+
+	row(u8"살아있는 오브젝트", ObjectManager::Get().GetLiveObjectCount());
+	row(u8"삭제 대기 오브젝트", ObjectManager::Get().GetPendingDestroyCount());
+	row(u8"지연 파괴 타이머", ObjectManager::Get().GetDelayedDestroyCount());
+	row(u8"활성 Behaviour", BehaviourManager::Get().GetActiveBehaviourCount());
+	row(u8"비활성 Behaviour", BehaviourManager::Get().GetInactiveBehaviourCount());
+	row(u8"물리 contact (직전 스텝)", PhysxManager::Get().GetLastContactCount());
+	row(u8"리소스 캐시 (살아있음)", ResourceManager::Get().GetCachedResourceCount());
+	row(u8"리소스 캐시 (항목)", ResourceManager::Get().GetCacheEntryCount());
+
+	ImGui::EndTable();
+
+	if (ImGui::TreeNode(u8"렌더커맨드"))
+	{
+		size_t total = 0;
+		for (int type = 0; type < R_END; ++type)
+		{
+			const size_t count = RenderManager::Get().GetCommandCount(static_cast<RenderType>(type));
+			total += count;
+			if (count > 0)
+				ImGui::BulletText("%s : %zu", kRenderTypeNames[type], count);
+		}
+		ImGui::Text(u8"합계 : %zu", total);
+		ImGui::TreePop();
+	}
+}
+
+void MMMEngine::Editor::ProfilerWindow::RenderScripts()
+{
+	BehaviourManager& behaviours = BehaviourManager::Get();
+
+	bool profiling = behaviours.IsScriptProfiling();
+	if (ImGui::Checkbox(u8"스크립트별 측정", &profiling))
+		behaviours.SetScriptProfiling(profiling);
+
+	ImGui::SameLine();
+	if (ImGui::Button(u8"초기화"))
+		behaviours.ResetScriptProfile();
+
+	ImGui::SameLine();
+	if (ImGui::Button(u8"콘솔로 출력"))
+		behaviours.DumpScriptProfile(std::cout);
+
+	const auto& profile = behaviours.GetScriptProfile();
+	if (profile.empty())
+	{
+		ImGui::TextDisabled(u8"플레이 중에 측정을 켜면 메시지별 스크립트 비용이 누적됩니다.");
+		return;
+	}
+
+	static const char* kMessages[] = { "Update", "LateUpdate", "FixedUpdate" };
+	ImGui::Combo(u8"메시지", &m_scriptMessage, kMessages, IM_ARRAYSIZE(kMessages));
+
+	auto it = profile.find(kMessages[m_scriptMessage]);
+	if (it == profile.end())
+		return;
+
+	const ScriptMessageStats& stats = it->second;
+	m_scriptTypes.clear();
+	for (const auto& type : stats.types)
+		m_scriptTypes.push_back(&type);
+	std::sort(m_scriptTypes.begin(), m_scriptTypes.end(),
+		[](const ScriptTypeStats* a, const ScriptTypeStats* b) { return a->totalMs > b->totalMs; });
+
+	const ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+		| ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp;
+	if (ImGui::BeginTable("##ProfilerScripts", 4, flags, ImVec2(0.0f, 160.0f)))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn(u8"타입", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableSetupColumn(u8"ms/브로드캐스트", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+		ImGui::TableSetupColumn(u8"최대 ms", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+		ImGui::TableSetupColumn(u8"호출", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+		ImGui::TableHeadersRow();
+
+		for (const ScriptTypeStats* type : m_scriptTypes)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableSetColumnIndex(0);
+			ImGui::TextUnformatted(type->typeName.c_str());
+			ImGui::TableSetColumnIndex(1);
+			ImGui::Text("%.4f", stats.broadcastCount ? type->totalMs / stats.broadcastCount : 0.0);
+			ImGui::TableSetColumnIndex(2);
+			ImGui::Text("%.4f", type->maxMs);
+			ImGui::TableSetColumnIndex(3);
+			ImGui::Text("%u", type->callCount);
+		}
+		ImGui::EndTable();
+	}
+
+	if (!stats.slowest.empty() && ImGui::TreeNode(u8"느린 인스턴스"))
+	{
+		for (const auto& cost : stats.slowest)
+			ImGui::BulletText("%.4f ms  %s (%s)", cost.ms, cost.typeName.c_str(), cost.objectName.c_str());
+		ImGui::TreePop();
+	}
+}
+
+void MMMEngine::Editor::ProfilerWindow::RenderMemory()
+{
+	// 리소스/스냅샷 집계는 캐시를 전부 훑으니 0.5초마다만 갱신
+	m_memoryRefreshTimer -= TimeManager::Get().GetUnscaledDeltaTime();
+	if (m_memoryRefreshTimer <= 0.0f)
+	{
+		MemoryTracker::Get().CollectReport(m_memoryReport);
+		m_memoryRefreshTimer = 0.5f;
+	}
+
+	if (ImGui::Button(u8"메모리 리포트 콘솔로 출력"))
+		MemoryTracker::Get().DumpReport(std::cout);
+
+	const ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+		| ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp;
+	if (ImGui::BeginTable("##ProfilerMemory", 4, flags, ImVec2(0.0f, 200.0f)))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn(u8"태그", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableSetupColumn("KB", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+		ImGui::TableSetupColumn(u8"개수", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+		ImGui::TableSetupColumn(u8"할당/프레임", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+		ImGui::TableHeadersRow();
+
+		for (const auto& tag : m_memoryReport.tags)
+		{
+			if (tag.liveCount == 0 && tag.frameAllocs == 0) continue;
+
+			ImGui::TableNextRow();
+			ImGui::TableSetColumnIndex(0);
+			ImGui::TextUnformatted(tag.name.c_str());
+			ImGui::TableSetColumnIndex(1);
+			ImGui::Text("%.1f", tag.liveBytes / 1024.0);
+			ImGui::TableSetColumnIndex(2);
+			ImGui::Text("%lld", static_cast<long long>(tag.liveCount));
+			ImGui::TableSetColumnIndex(3);
+			ImGui::Text("%u", tag.frameAllocs);
+		}
+
+		for (const auto& res : m_memoryReport.resources)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableSetColumnIndex(0);
+			ImGui::Text("Resource/%s", res.typeName.c_str());
+			ImGui::TableSetColumnIndex(1);
+			ImGui::Text("%.1f", res.bytes / 1024.0);
+			ImGui::TableSetColumnIndex(2);
+			ImGui::Text("%zu", res.count);
+		}
+
+		ImGui::TableNextRow();
+		ImGui::TableSetColumnIndex(0);
+		ImGui::TextUnformatted(u8"씬 스냅샷");
+		ImGui::TableSetColumnIndex(1);
+		ImGui::Text("%.1f", m_memoryReport.sceneSnapShotBytes / 1024.0);
+
+		ImGui::EndTable();
+	}
+}
+
+void MMMEngine::Editor::ProfilerWindow::RenderCapture()
+{
+	Profiler& profiler = Profiler::Get();
+
+	if (ImGui::Button(u8"버퍼 비우기"))
+	{
+		// 기록 중에 비우면 다른 스레드가 쓰는 중일 수 있어서 잠깐 멈췄다가 복구
+		const bool wasEnabled = profiler.IsEnabled();
+		profiler.SetEnabled(false);
+		profiler.Clear();
+		profiler.SetEnabled(wasEnabled);
+		m_captureMessage.clear();
+	}
+
+	ImGui::SameLine();
+	if (ImGui::Button(u8"파일로 캡처"))
+	{
+		const auto path = MakeCapturePath();
+		m_captureMessage = profiler.ExportChromeTrace(path)
+			? u8"저장됨 : " + path.u8string()
+			: u8"저장 실패 : " + path.u8string();
+	}
+
+	if (!m_captureMessage.empty())
+		ImGui::TextWrapped("%s", m_captureMessage.c_str());
+}
+
+void MMMEngine::Editor::ProfilerWindow::Render()
+{
+	if (!g_editor_window_profiler)
+		return;
+
+	RecordFrameTime();
+
+	if (ImGui::Begin(u8"프로파일러", &g_editor_window_profiler))
+	{
+		RenderFrameGraph();
+		ImGui::Separator();
+
+		if (ImGui::CollapsingHeader(u8"시스템별 시간", ImGuiTreeNodeFlags_DefaultOpen))
+			RenderZones();
+
+		if (ImGui::CollapsingHeader(u8"엔진 카운터", ImGuiTreeNodeFlags_DefaultOpen))
+			RenderCounters();
+
+		if (ImGui::CollapsingHeader(u8"스크립트"))
+			RenderScripts();
+
+		if (ImGui::CollapsingHeader(u8"메모리"))
+			RenderMemory();
+
+		if (ImGui::CollapsingHeader(u8"캡처", ImGuiTreeNodeFlags_DefaultOpen))
+			RenderCapture();
+	}
+	ImGui::End();
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <array>
+#include <string>
+#include <vector>
+#include "Singleton.hpp"
+#include "Profiler.h"
+#include "BehaviourManager.h"
+#include "MemoryTracker.h"
+
+namespace MMMEngine::Editor
+{
+	class ProfilerWindow : public Utility::Singleton<ProfilerWindow>
+	{
+	public:
+		void Render();
+
+	private:
+		static constexpr size_t kHistorySize = 240;
+
+		std::array<float, kHistorySize> m_frameTimes{};
+		size_t m_frameOffset = 0;
+		bool m_paused = false;
+
+		std::vector<ProfileZoneStat> m_zones;
+		std::vector<const ScriptTypeStats*> m_scriptTypes;
+		int m_scriptMessage = 0;
+		MemoryReport m_memoryReport;
+		float m_memoryRefreshTimer = 0.0f;
+		std::string m_captureMessage;
+
+		void RecordFrameTime();
+		void RenderFrameGraph();
+		void RenderZones();
+		void RenderCounters();
+		void RenderScripts();
+		void RenderMemory();
+		void RenderCapture();
+	};
+}
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "ResourceManager.h"
 #include "TimeManager.h"
 #include "RenderManager.h"
+#include "JobSystem.h"
 #include "BehaviourManager.h"
 #include "SceneManager.h"
 #include "ObjectManager.h"
@@ -23,6 +24,9 @@
 #include "PhysX.h"
 #include "ShaderInfo.h"
 #include "PhysicsSettings.h"
+#include "PhysicsMeshCache.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
 
 namespace fs = std::filesystem;
 using namespace MMMEngine;
@@ -66,10 +70,13 @@ void AfterProjectLoaded()
 void Initialize()
 {
 	SetConsoleOutputCP(CP_UTF8);
+	Profiler::Get().StartUp();
+	Profiler::Get().SetThreadName("Main");
 	auto app = GlobalRegistry::g_pApp;
 	auto hwnd = app->GetWindowHandle();
 	auto windowInfo = app->GetWindowInfo();
 
+	JobSystem::Get().StartUp();
 	RenderManager::Get().StartUp(hwnd, windowInfo.width, windowInfo.height);
 	InputManager::Get().StartUp(hwnd);
 	app->OnWindowSizeChanged.AddListener<InputManager, &InputManager::HandleWindowResize>(&InputManager::Get());
@@ -122,6 +129,9 @@ void Update_ProjectNotLoaded()
 
 void Update()
 {
+	MMM_PROFILE_FRAME();
+	MemoryTracker::Get().BeginFrame();
+
 	if (!EditorRegistry::g_editor_project_loaded)
 	{
 		Update_ProjectNotLoaded();
@@ -156,50 +166,7 @@ void Update()
 				return;
 			}
 
-			BehaviourManager::Get().BroadCastBehaviourMessage("FixedUpdate");
-			PhysxManager::Get().StepFixed(fixedDt);
-
-			std::vector<std::variant<CollisionInfo, TriggerInfo>> vec;
-
-			std::swap(vec, PhysxManager::Get().GetCallbackQue());
-
-			for (auto& ev : vec)
-			{
-				//기존은 enum으로 switch 분기, variant를 쓰면서 실제타입분리를 위해 visit를 사용
-				//variant 안에 들어 있는 실제 타입에 따라 함수를 호출
-				std::visit([&](auto& e)
-					{
-						using T = std::decay_t<decltype(e)>;
-
-						if constexpr (std::is_same_v<T, CollisionInfo>)
-						{
-							switch (e.phase)
-							{
-							case CollisionPhase::Enter:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionEnter", e);
-								break;
-							case CollisionPhase::Stay:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionStay", e);
-								break;
-							case CollisionPhase::Exit:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionExit", e);
-								break;
-							}
-						}
-						else if constexpr (std::is_same_v<T, TriggerInfo>)
-						{
-							switch (e.phase)
-							{
-							case TriggerPhase::Enter:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnTriggerEnter", e);
-								break;
-							case TriggerPhase::Exit:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnTriggerExit", e);
-								break;
-							}
-						}
-					}, ev);
-			}
+			PhysxManager::Get().RunFixedStep(fixedDt);
 		});
 
 
@@ -208,6 +175,9 @@ void Update()
 	{
 		BehaviourManager::Get().BroadCastBehaviourMessage("Update");
 		BehaviourManager::Get().BroadCastBehaviourMessage("LateUpdate");
+
+		// 비동기 물리 동기화 지점
+		PhysxManager::Get().SyncStepAndDispatch();
 	}
 
 	if (EditorRegistry::g_editor_scene_playing
@@ -241,12 +211,15 @@ void Release()
 	GlobalRegistry::g_pApp = nullptr;
 	ImGuiEditorContext::Get().Uninitialize();
 	RenderManager::Get().ShutDown();
+	JobSystem::Get().ShutDown();
 	TimeManager::Get().ShutDown();
 	InputManager::Get().ShutDown();
 
 	SceneManager::Get().ShutDown();
+	PhysicsMeshCache::Get().ShutDown();
 	ObjectManager::Get().ShutDown();
 	BehaviourManager::Get().ShutDown();
+	Profiler::Get().ShutDown();
 
 	fs::path cwd = fs::current_path();
 	DLLHotLoadHelper::CleanupHotReloadCopies(cwd);
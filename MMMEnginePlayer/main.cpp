@@ -1,5 +1,6 @@
 ﻿#define NOMINMAX
 #include <iostream>
+#include <fstream>
 
 #include "GlobalRegistry.h"
 #include "PlayerRegistry.h"
@@ -9,21 +10,35 @@
 #include "ResourceManager.h"
 #include "TimeManager.h"
 #include "RenderManager.h"
+#include "JobSystem.h"
 #include "BehaviourManager.h"
 #include "SceneManager.h"
 #include "ObjectManager.h"
 #include "PhysxManager.h"
 
 #include "PhysicsSettings.h"
+#include "PhysicsMeshCache.h"
 #include "ShaderInfo.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
 
 namespace fs = std::filesystem;
 using namespace MMMEngine;
 using namespace MMMEngine::Utility;
 using namespace Microsoft::WRL;
 
+// -profile 로 실행하면 전체 실행 구간을 기록해서 종료 시 Chrome trace + 스크립트별 비용으로 저장
+bool g_profileCapture = false;
+// -fps <N> 로 실행하면 프레임 속도 제한 (vsync가 꺼진 환경이나 창이 최소화되어 Present가 바로 리턴될때)
+int g_targetFrameRate = 0;
+
 void Initialize()
 {
+	Profiler::Get().StartUp();
+	Profiler::Get().SetThreadName("Main");
+	Profiler::Get().SetEnabled(g_profileCapture);
+	BehaviourManager::Get().SetScriptProfiling(g_profileCapture);
+
 	fs::path cwd = fs::current_path();
 
 	fs::path dataPath = cwd / "Data";
@@ -33,6 +48,7 @@ void Initialize()
 	auto hwnd = app->GetWindowHandle();
 	auto windowInfo = app->GetWindowInfo();
 
+	JobSystem::Get().StartUp();
 	RenderManager::Get().StartUp(hwnd, windowInfo.width, windowInfo.height);
 	RenderManager::Get().UseBackBufferDraw(true);
 	InputManager::Get().StartUp(hwnd);
@@ -40,11 +56,13 @@ void Initialize()
 	app->OnMouseWheelUpdate.AddListener<InputManager, &InputManager::HandleMouseWheelEvent>(&InputManager::Get());
 
 	TimeManager::Get().StartUp();
+	TimeManager::Get().SetTargetFrameRate(g_targetFrameRate);
 
 	SceneManager::Get().StartUp(dataPath.generic_wstring() + L"/Assets/Scenes", 0);
 	ObjectManager::Get().StartUp();
 
 	PhysicsSettings::Get().StartUp(dataPath / "Settings");
+	PhysxManager::Get().SetAsyncStep(true);
 
 	// 유저 스크립트 불러오기
 	auto dllPath = cwd / "UserScripts.dll";
@@ -72,6 +90,8 @@ void Initialize()
 
 void Update()
 {
+	MMM_PROFILE_FRAME();
+	MemoryTracker::Get().BeginFrame();
 	TimeManager::Get().BeginFrame();
 	InputManager::Get().Update();
 
@@ -89,56 +109,15 @@ void Update()
 
 	TimeManager::Get().ConsumeFixedSteps([&](float fixedDt)
 		{
-			PhysxManager::Get().SetStep();
-			BehaviourManager::Get().BroadCastBehaviourMessage("FixedUpdate");
-			PhysxManager::Get().StepFixed(fixedDt);
-
-			std::vector<std::variant<CollisionInfo, TriggerInfo>> vec;
-
-			std::swap(vec, PhysxManager::Get().GetCallbackQue());
-
-			for (auto& ev : vec)
-			{
-				//기존은 enum으로 switch 분기, variant를 쓰면서 실제타입분리를 위해 visit를 사용
-				//variant 안에 들어 있는 실제 타입에 따라 함수를 호출
-				std::visit([&](auto& e)
-					{
-						using T = std::decay_t<decltype(e)>;
-
-						if constexpr (std::is_same_v<T, CollisionInfo>)
-						{
-							switch (e.phase)
-							{
-							case CollisionPhase::Enter:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionEnter", e);
-								break;
-							case CollisionPhase::Stay:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionStay", e);
-								break;
-							case CollisionPhase::Exit:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionExit", e);
-								break;
-							}
-						}
-						else if constexpr (std::is_same_v<T, TriggerInfo>)
-						{
-							switch (e.phase)
-							{
-							case TriggerPhase::Enter:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnTriggerEnter", e);
-								break;
-							case TriggerPhase::Exit:
-								BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnTriggerExit", e);
-								break;
-							}
-						}
-					}, ev);
-			}
+			PhysxManager::Get().RunFixedStep(fixedDt);
 		});
 
 	BehaviourManager::Get().BroadCastBehaviourMessage("Update");
 	BehaviourManager::Get().BroadCastBehaviourMessage("LateUpdate");
 
+	// 비동기 물리 동기화 지점 (Update/LateUpdate 와 겹쳐 돌던 스텝 결과 반영)
+	PhysxManager::Get().SyncStepAndDispatch();
+
 	PhysxManager::Get().ApplyInterpolation(TimeManager::Get().GetInterpolationAlpha());
 
 	RenderManager::Get().BeginFrame();
@@ -152,17 +131,32 @@ void Update()
 
 void Release()
 {
+	if (g_profileCapture)
+	{
+		const fs::path profileDir = fs::current_path() / "Profile";
+		std::error_code ec;
+		fs::create_directories(profileDir, ec);
+		std::ofstream scriptProfile(profileDir / "scripts.txt", std::ios::trunc);
+		BehaviourManager::Get().DumpScriptProfile(scriptProfile);
+	}
+
 	PhysxManager::Get().UnbindScene();
 	GlobalRegistry::g_pApp = nullptr;
 	RenderManager::Get().ShutDown();
+	JobSystem::Get().ShutDown();
 	TimeManager::Get().ShutDown();
 	InputManager::Get().ShutDown();
 
 	SceneManager::Get().ShutDown();
+	PhysicsMeshCache::Get().ShutDown();
 	ObjectManager::Get().ShutDown();
 	BehaviourManager::Get().ShutDown();
 
 	fs::path cwd = fs::current_path();
+
+	if (g_profileCapture)
+		Profiler::Get().ExportChromeTrace(cwd / "Profile" / "trace.json");
+	Profiler::Get().ShutDown();
 }
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
@@ -170,6 +164,10 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 	_In_ LPWSTR    lpCmdLine,
 	_In_ int       nCmdShow)
 {
+	g_profileCapture = (lpCmdLine && wcsstr(lpCmdLine, L"-profile") != nullptr);
+	if (const wchar_t* fpsArg = lpCmdLine ? wcsstr(lpCmdLine, L"-fps ") : nullptr)
+		g_targetFrameRate = _wtoi(fpsArg + 5);
+
 	App app{ hInstance,L"MMMPlayer",1280,720 };
 	GlobalRegistry::g_pApp = &app;
 
@@ -70,15 +70,20 @@ int MMMEngine::Utility::App::Run()
 			m_windowSizeDirty = false;
 		}
 
-		if (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
+		//  ޽  óϰ    ( ӵ  TimeManager::BeginFrame )
+		while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+		{
+			if (msg.message == WM_QUIT)
+				break;
 			TranslateMessage(&msg);
 			DispatchMessage(&msg);
 		}
-		else
-		{
-			OnUpdate(this);
-			OnRender(this);
-		}
+
+		if (msg.message == WM_QUIT)
+			break;
+
+		OnUpdate(this);
+		OnRender(this);
 	}
 	OnRelease(this);
 
@@ -37,8 +37,8 @@ void MMMEngine::Behaviour::SetEnabled(bool value)
 {
 	if (value != m_enabled)
 	{
-		//바뀔 때 무언갈 실행하는 코드 작성하기
 		m_enabled = value;
+		BehaviourManager::Get().NotifyActivationChanged(SelfPtr(this));
 	}
 }
 
@@ -93,6 +93,12 @@ namespace MMMEngine
 
 		std::unordered_map<std::string, std::unique_ptr<BehaviourMessageBase>> m_messages;
 
+		// BehaviourManager  ϴ  (ִ , Ȱ   ġ, Ȱ  ť  )
+		enum class ListState : uint8_t { None, Inactive, Active };
+		ListState m_listState = ListState::None;
+		uint32_t m_inactiveIndex = UINT32_MAX;
+		bool m_activationQueued = false;
+
 		// ȣ - Ű 
 		void CallMessage(const std::string& name)
 		{
@@ -1,4 +1,5 @@
 ﻿#include "BehaviourManager.h"
+#include <cstdio>
 
 DEFINE_SINGLETON(MMMEngine::BehaviourManager)
 
@@ -20,35 +21,101 @@ bool MMMEngine::BehaviourManager::StartUp(const std::string& userScriptsDLLPath)
 void MMMEngine::BehaviourManager::ShutDown()
 {
 	m_pScriptLoader.release();
+	ClearBehaviourLists();
+}
+
+void MMMEngine::BehaviourManager::AddInactive(const ObjPtr<Behaviour>& behaviour)
+{
+	behaviour->m_listState = Behaviour::ListState::Inactive;
+	behaviour->m_inactiveIndex = static_cast<uint32_t>(m_inactiveBehaviours.size());
+	m_inactiveBehaviours.push_back(behaviour);
+}
+
+void MMMEngine::BehaviourManager::RemoveInactive(Behaviour& behaviour)
+{
+	const uint32_t index = behaviour.m_inactiveIndex;
+	if (index >= m_inactiveBehaviours.size())
+		return;
+
+	if (index + 1 != m_inactiveBehaviours.size())
+	{
+		m_inactiveBehaviours[index] = std::move(m_inactiveBehaviours.back());
+		m_inactiveBehaviours[index]->m_inactiveIndex = index;
+	}
+	m_inactiveBehaviours.pop_back();
+
+	behaviour.m_inactiveIndex = UINT32_MAX;
+	behaviour.m_listState = Behaviour::ListState::None;
+}
+
+void MMMEngine::BehaviourManager::ClearBehaviourLists()
+{
+	auto reset = [](ObjPtr<Behaviour>& behaviour)
+		{
+			if (!behaviour.IsValid())
+				return;
+
+			behaviour->m_listState = Behaviour::ListState::None;
+			behaviour->m_inactiveIndex = UINT32_MAX;
+			behaviour->m_activationQueued = false;
+		};
+
+	for (auto& behaviour : m_activeBehaviours) reset(behaviour);
+	for (auto& behaviour : m_inactiveBehaviours) reset(behaviour);
+	for (auto& behaviour : m_activationChanged) reset(behaviour);
+
 	m_activeBehaviours.clear();
 	m_inactiveBehaviours.clear();
+	m_activationChanged.clear();
+	m_firstCallBehaviours.clear();
+	m_needSort = false;
 }
 
 void MMMEngine::BehaviourManager::RegisterBehaviour(ObjPtr<Behaviour> behaviour)
 {
-	m_inactiveBehaviours.push_back(behaviour);
+	AddInactive(behaviour);
 	m_firstCallBehaviours.insert(behaviour);
 	m_needSort = true; // Behaviour 정렬이 필요함을 표시
+
+	// 활성 상태로 생성됐으면 다음 InitializeBehaviours 에서 Awake/OnEnable/Start
+	NotifyActivationChanged(behaviour);
 }
 
 void MMMEngine::BehaviourManager::UnRegisterBehaviour(ObjPtr<Behaviour> behaviour)
 {
-	auto it = std::find(m_activeBehaviours.begin(), m_activeBehaviours.end(), behaviour);
-	if (it != m_activeBehaviours.end())
+	switch (behaviour->m_listState)
 	{
-		m_activeBehaviours.erase(it);
-	}
-	else
+	case Behaviour::ListState::Active:
 	{
-		it = std::find(m_inactiveBehaviours.begin(), m_inactiveBehaviours.end(), behaviour);
-		if (it != m_inactiveBehaviours.end())
-		{
-			m_inactiveBehaviours.erase(it);
-		}
+		auto it = std::find(m_activeBehaviours.begin(), m_activeBehaviours.end(), behaviour);
+		if (it != m_activeBehaviours.end())
+			m_activeBehaviours.erase(it);
+		break;
+	}
+	case Behaviour::ListState::Inactive:
+		RemoveInactive(*behaviour);
+		break;
+	default:
+		break;
 	}
+
+	// 큐에 남은 항목은 처리할 때 None 상태라서 버려짐
+	behaviour->m_listState = Behaviour::ListState::None;
+	m_firstCallBehaviours.erase(behaviour);
 	m_needSort = true; // Behaviour 정렬이 필요함을 표시
 }
 
+void MMMEngine::BehaviourManager::NotifyActivationChanged(const ObjPtr<Behaviour>& behaviour)
+{
+	if (!behaviour.IsValid()
+		|| behaviour->m_activationQueued
+		|| behaviour->m_listState == Behaviour::ListState::None)
+		return;
+
+	behaviour->m_activationQueued = true;
+	m_activationChanged.push_back(behaviour);
+}
+
 void MMMEngine::BehaviourManager::SortBehaviours()
 {
 	std::sort(m_activeBehaviours.begin(), m_activeBehaviours.end(),
@@ -68,111 +135,288 @@ void MMMEngine::BehaviourManager::AllSortBehaviours()
 		[](ObjPtr<Behaviour> a, ObjPtr<Behaviour> b) {
 			return a->m_executionOrder < b->m_executionOrder;
 		});
+
+	// 정렬로 자리가 바뀌었으니 제거용 인덱스 다시 기록
+	for (uint32_t i = 0; i < m_inactiveBehaviours.size(); ++i)
+		m_inactiveBehaviours[i]->m_inactiveIndex = i;
 }
 
 void MMMEngine::BehaviourManager::InitializeBehaviours()
 {
-	// 활성화된 Behaviour를 모으는 컨테이너.
-// count() 메서드로 O(1)에 존재 여부 확인 가능.
-	std::unordered_set<ObjPtr<Behaviour>> changedBehavioursSet;
+	MMM_PROFILE_FUNCTION();
 
-	// 이전에 생성되어 활성화된 적 없는 Behaviour를 효율적으로 찾기 위한 set
-	std::unordered_set<ObjPtr<Behaviour>> newBehavioursSet;
+	// 이번에 활성화된 Behaviour (변경 큐만 보므로 비활성 Behaviour 전체 수와 무관)
+	std::vector<ObjPtr<Behaviour>> enabledBehaviours;
 
-	// m_inactiveBehaviours를 순회하며 활성화 객체 처리
-	auto it = m_inactiveBehaviours.begin();
-	while (it != m_inactiveBehaviours.end())
+	size_t keep = 0;
+	for (size_t i = 0; i < m_activationChanged.size(); ++i)
 	{
-		ObjPtr<Behaviour> currentBehaviour = *it;
-		if (currentBehaviour->IsActiveAndEnabled())
+		ObjPtr<Behaviour> currentBehaviour = m_activationChanged[i];
+		if (!currentBehaviour.IsValid())
+			continue;
+
+		const auto state = currentBehaviour->m_listState;
+		const bool active = state != Behaviour::ListState::None
+			&& !currentBehaviour->IsDestroyed()
+			&& currentBehaviour->IsActiveAndEnabled();
+
+		if (state == Behaviour::ListState::Inactive && active)
 		{
+			RemoveInactive(*currentBehaviour);
+			currentBehaviour->m_listState = Behaviour::ListState::Active;
+			currentBehaviour->m_activationQueued = false;
 			m_activeBehaviours.push_back(currentBehaviour);
-			changedBehavioursSet.insert(currentBehaviour); // OnEnable 호출을 위해 추가
-
-			// m_firstCallBehaviours에서 찾고, newBehavioursSet에 추가 및 m_firstCallBehaviours에서 제거
-			if (m_firstCallBehaviours.erase(currentBehaviour) > 0) // 요소가 성공적으로 제거되면
-			{
-				newBehavioursSet.insert(currentBehaviour); // 새로운 Behaviour로 간주
-			}
+			enabledBehaviours.push_back(currentBehaviour);
 			m_needSort = true;
-
-			// m_inactiveBehaviours에서 현재 요소를 제거
-			it = m_inactiveBehaviours.erase(it);
+		}
+		else if (state == Behaviour::ListState::Active && !active)
+		{
+			// 꺼진 건 DisableBehaviours 에서 OnDisable 과 함께 처리
+			m_activationChanged[keep++] = currentBehaviour;
 		}
 		else
 		{
-			++it;
+			currentBehaviour->m_activationQueued = false;
 		}
 	}
+	m_activationChanged.resize(keep);
 
 	// 활성화 behaviour 정렬 (필요시에)
 	CheckAndSortBehaviours();
 
+	if (enabledBehaviours.empty())
+		return;
+
+	// 활성 목록과 같은 기준(실행 순서)으로 호출
+	std::stable_sort(enabledBehaviours.begin(), enabledBehaviours.end(),
+		[](const ObjPtr<Behaviour>& a, const ObjPtr<Behaviour>& b) {
+			return a->m_executionOrder < b->m_executionOrder;
+		});
+
+	// 이전에 활성화된 적 없는 Behaviour
+	std::vector<ObjPtr<Behaviour>> newBehaviours;
+	for (auto& behaviour : enabledBehaviours)
+	{
+		if (m_firstCallBehaviours.erase(behaviour) > 0)
+			newBehaviours.push_back(behaviour);
+	}
+
 	// 1. Awake 호출 (새로운 객체만)
-	for (auto& behaviour : m_activeBehaviours)
+	for (auto& behaviour : newBehaviours)
 	{
-		if (newBehavioursSet.count(behaviour) > 0)
-		{
+		if (behaviour.IsValid())
 			behaviour->CallMessage("Awake");
-		}
 	}
 
 	// 2. OnEnable 호출 (새롭게 활성화된 모든 객체)
-	for (auto& behaviour : m_activeBehaviours)
+	for (auto& behaviour : enabledBehaviours)
 	{
-		if (changedBehavioursSet.count(behaviour) > 0)
-		{
+		if (behaviour.IsValid())
 			behaviour->CallMessage("OnEnable");
-		}
 	}
 
 	// 3. Start 호출 (새로운 객체만)
-	for (auto& behaviour : m_activeBehaviours)
+	for (auto& behaviour : newBehaviours)
 	{
-		if (newBehavioursSet.count(behaviour) > 0)
-		{
+		if (behaviour.IsValid())
 			behaviour->CallMessage("Start");
-		}
 	}
 }
 
 void MMMEngine::BehaviourManager::DisableBehaviours()
 {
-	auto it = m_activeBehaviours.begin();
-	while (it != m_activeBehaviours.end())
+	MMM_PROFILE_FUNCTION();
+
+	std::vector<ObjPtr<Behaviour>> disabledBehaviours;
+
+	size_t keep = 0;
+	for (size_t i = 0; i < m_activationChanged.size(); ++i)
 	{
-		ObjPtr<Behaviour> currentBehaviour = *it;
-		if (!currentBehaviour->IsActiveAndEnabled() || currentBehaviour->IsDestroyed())
-		{
-			(*it)->CallMessage("OnDisable");
-			m_needSort = true;
+		ObjPtr<Behaviour> currentBehaviour = m_activationChanged[i];
+		if (!currentBehaviour.IsValid())
+			continue;
+
+		const auto state = currentBehaviour->m_listState;
+		const bool active = state != Behaviour::ListState::None
+			&& !currentBehaviour->IsDestroyed()
+			&& currentBehaviour->IsActiveAndEnabled();
 
-			m_inactiveBehaviours.push_back(currentBehaviour); // 바로 m_inactiveBehaviours로 이동
-			it = m_activeBehaviours.erase(it); // m_activeBehaviours에서 제거
+		if (state == Behaviour::ListState::Active && !active)
+		{
+			currentBehaviour->m_activationQueued = false;
+			AddInactive(currentBehaviour); // 바로 m_inactiveBehaviours로 이동
+			disabledBehaviours.push_back(currentBehaviour);
+		}
+		else if (state == Behaviour::ListState::Inactive && active)
+		{
+			// 켜진 건 다음 InitializeBehaviours 에서 처리
+			m_activationChanged[keep++] = currentBehaviour;
 		}
 		else
 		{
-			++it;
+			currentBehaviour->m_activationQueued = false;
 		}
 	}
+	m_activationChanged.resize(keep);
 
-	for (auto& inactive : m_inactiveBehaviours)
+	if (!disabledBehaviours.empty())
 	{
-		if (inactive->IsDestroyed())
+		// m_activeBehaviours에서 한번에 제거 (실행 순서 유지)
+		m_activeBehaviours.erase(
+			std::remove_if(m_activeBehaviours.begin(), m_activeBehaviours.end(),
+				[](const ObjPtr<Behaviour>& behaviour) {
+					return behaviour->m_listState != Behaviour::ListState::Active;
+				}),
+			m_activeBehaviours.end());
+		m_needSort = true;
+
+		std::stable_sort(disabledBehaviours.begin(), disabledBehaviours.end(),
+			[](const ObjPtr<Behaviour>& a, const ObjPtr<Behaviour>& b) {
+				return a->m_executionOrder < b->m_executionOrder;
+			});
+
+		for (auto& behaviour : disabledBehaviours)
 		{
-			inactive->CallMessage("OnDestroy");
+			if (behaviour.IsValid())
+				behaviour->CallMessage("OnDisable");
 		}
 	}
+
+	++m_disablePassCount;
 }
 
 void MMMEngine::BehaviourManager::BroadCastBehaviourMessage(const std::string& messageName)
 {
+	MMM_PROFILE_SCOPE_DYNAMIC(messageName);
+	if (m_scriptProfiling)
+	{
+		ScriptMessageStats& stats = AcquireScriptStats(messageName);
+		for (auto& behaviour : m_activeBehaviours)
+		{
+			if (!HasMessage(behaviour, messageName)) continue;
+			ScriptCallScope scope(stats, *behaviour);
+			behaviour->CallMessage(messageName);
+		}
+		return;
+	}
+
 	for (auto& behaviour : m_activeBehaviours)
 	{
 		behaviour->CallMessage(messageName);
 	}
 }
 
+void MMMEngine::BehaviourManager::SetScriptProfiling(bool enabled)
+{
+	m_scriptProfiling = enabled;
+}
+
+MMMEngine::ScriptMessageStats& MMMEngine::BehaviourManager::AcquireScriptStats(const std::string& messageName)
+{
+	ScriptMessageStats& stats = m_scriptStats[messageName];
+	if (stats.message.empty())
+		stats.message = messageName;
+	++stats.broadcastCount;
+	return stats;
+}
+
+size_t MMMEngine::BehaviourManager::AcquireScriptType(ScriptMessageStats& stats, Behaviour& behaviour)
+{
+	const rttr::type type = behaviour.get_type();
+	auto it = stats.typeIndex.find(type.get_id());
+	if (it != stats.typeIndex.end())
+		return it->second;
+
+	// 타입별 첫 호출에만 이름을 만들고 intern (이후 호출은 id 조회만)
+	ScriptTypeStats entry;
+	entry.typeName = type.get_name().to_string();
+	entry.zoneName = Profiler::Get().Intern(entry.typeName + "::" + stats.message);
+
+	const size_t index = stats.types.size();
+	stats.types.push_back(std::move(entry));
+	stats.typeIndex.emplace(type.get_id(), index);
+	return index;
+}
+
+void MMMEngine::BehaviourManager::RecordScriptCall(ScriptMessageStats& stats, size_t typeIndex, Behaviour& behaviour, double ms)
+{
+	ScriptTypeStats& type = stats.types[typeIndex];
+	++type.callCount;
+	type.totalMs += ms;
+	type.maxMs = (std::max)(type.maxMs, ms);
+
+	if (m_scriptTopN == 0) return;
+	// 상위 목록이 찼고 꼴찌보다 빠르면 문자열 복사 없이 종료 (대부분의 호출)
+	if (stats.slowest.size() >= m_scriptTopN && ms <= stats.slowest.back().ms) return;
+
+	ScriptInstanceCost cost;
+	cost.typeName = type.typeName;
+	if (auto go = behaviour.GetGameObject(); go.IsValid())
+		cost.objectName = go->GetName();
+	cost.ms = ms;
+
+	auto pos = std::upper_bound(stats.slowest.begin(), stats.slowest.end(), ms,
+		[](double value, const ScriptInstanceCost& c) { return value > c.ms; });
+	stats.slowest.insert(pos, std::move(cost));
+	if (stats.slowest.size() > m_scriptTopN)
+		stats.slowest.resize(m_scriptTopN);
+}
+
+void MMMEngine::BehaviourManager::DumpScriptProfile(std::ostream& out) const
+{
+	if (m_scriptStats.empty())
+	{
+		out << "[ScriptProfile] no samples (SetScriptProfiling(true) first)\n";
+		return;
+	}
+
+	for (const auto& [name, stats] : m_scriptStats)
+	{
+		std::vector<const ScriptTypeStats*> sorted;
+		sorted.reserve(stats.types.size());
+		for (const auto& type : stats.types)
+			sorted.push_back(&type);
+		std::sort(sorted.begin(), sorted.end(),
+			[](const ScriptTypeStats* a, const ScriptTypeStats* b) { return a->totalMs > b->totalMs; });
+
+		char line[256];
+		std::snprintf(line, sizeof(line), "[ScriptProfile] %s (broadcasts %u)\n", name.c_str(), stats.broadcastCount);
+		out << line;
+
+		for (const ScriptTypeStats* type : sorted)
+		{
+			const double avgMs = type->callCount ? type->totalMs / type->callCount : 0.0;
+			std::snprintf(line, sizeof(line), "  %-32s total %9.3f ms  calls %7u  avg %7.4f ms  max %7.4f ms\n",
+				type->typeName.c_str(), type->totalMs, type->callCount, avgMs, type->maxMs);
+			out << line;
+		}
+
+		if (!stats.slowest.empty())
+			out << "  slowest instances:\n";
+		for (const auto& cost : stats.slowest)
+		{
+			std::snprintf(line, sizeof(line), "    %7.4f ms  %s (%s)\n",
+				cost.ms, cost.typeName.c_str(), cost.objectName.c_str());
+			out << line;
+		}
+	}
+}
+
+MMMEngine::BehaviourManager::ScriptCallScope::ScriptCallScope(ScriptMessageStats& stats, Behaviour& behaviour)
+	: m_stats(stats)
+	, m_behaviour(behaviour)
+	, m_typeIndex(BehaviourManager::Get().AcquireScriptType(stats, behaviour))
+	, m_zone(stats.types[m_typeIndex].zoneName)
+	, m_startNs(Profiler::NowNs())
+{
+}
+
+MMMEngine::BehaviourManager::ScriptCallScope::~ScriptCallScope()
+{
+	const double ms = static_cast<double>(Profiler::NowNs() - m_startNs) / 1000000.0;
+	BehaviourManager::Get().RecordScriptCall(m_stats, m_typeIndex, m_behaviour, ms);
+}
+
 bool MMMEngine::BehaviourManager::ReloadUserScripts(const std::string& name)
 {
 	return m_pScriptLoader->LoadScriptDLL(name);
@@ -191,10 +435,11 @@ void MMMEngine::BehaviourManager::UnloadUserScripts()
 		}
 	}
 
+	// 언로드된 DLL의 타입 id가 재사용될 수 있으니 측정값과 클론 플랜도 같이 비움
+	m_scriptStats.clear();
+	Object::ClearInstantiateCache();
+
 	// Behaviour 컨테이너 싹 비우기
-	m_activeBehaviours.clear();
-	m_inactiveBehaviours.clear();
-	m_firstCallBehaviours.clear();
-	m_needSort = false;
+	ClearBehaviourLists();
 }
 
@@ -3,22 +3,57 @@
 #include <string>
 #include <queue>
 #include <algorithm>
+#include <ostream>
+#include <unordered_map>
 
 #include "ExportSingleton.hpp"
 #include "Behaviour.h"
 #include "ScriptLoader.h"
+#include "Profiler.h"
 
 namespace MMMEngine
 {
+	// 스크립트 타입(rttr 이름)별 메시지 호출 비용 누적
+	struct ScriptTypeStats
+	{
+		std::string typeName;
+		const char* zoneName = nullptr;	// "타입::메시지" (Profiler::Intern, 프로파일러 zone 이름)
+		uint32_t callCount = 0;
+		double totalMs = 0.0;
+		double maxMs = 0.0;
+	};
+
+	// 1회 호출 기준으로 느렸던 인스턴스
+	struct ScriptInstanceCost
+	{
+		std::string typeName;
+		std::string objectName;
+		double ms = 0.0;
+	};
+
+	struct ScriptMessageStats
+	{
+		std::string message;
+		uint32_t broadcastCount = 0;
+		std::vector<ScriptTypeStats> types;
+		std::unordered_map<rttr::type::type_id, size_t> typeIndex;
+		std::vector<ScriptInstanceCost> slowest;	// ms 내림차순, 최대 topN개
+	};
+
 	class MMMENGINE_API BehaviourManager : public Utility::ExportSingleton<BehaviourManager>
 	{
 	private:
 		friend class Behaviour;
 
 		bool m_needSort = false; // Behaviour 정렬이 필요한지 여부
+		uint32_t m_disablePassCount = 0; // DisableBehaviours 처리 횟수
 		std::vector<ObjPtr<Behaviour>> m_activeBehaviours; // 활성화된 Behaviour를 저장하는 벡터
-		std::vector<ObjPtr<Behaviour>> m_inactiveBehaviours; // 비활성화된 Behaviour를 저장하는 벡터
+		std::vector<ObjPtr<Behaviour>> m_inactiveBehaviours; // 비활성화된 Behaviour를 저장하는 벡터 (순서는 AllSortBehaviours 때만 맞춤)
 		std::unordered_set<ObjPtr<Behaviour>> m_firstCallBehaviours;
+
+		// 활성 상태가 바뀌었을 수 있는 Behaviour (등록, SetEnabled, activeInHierarchy 변경 시 들어옴)
+		// Initialize/DisableBehaviours 는 전체 목록 대신 이것만 확인하고, 다른 쪽에서 처리할 항목은 남겨둠
+		std::vector<ObjPtr<Behaviour>> m_activationChanged;
 		std::unique_ptr<ScriptLoader> m_pScriptLoader;
 
 		// Behaviour를 등록하는 함수
@@ -27,6 +62,44 @@ namespace MMMEngine
 		// Behaviour를 제거하는 함수
 		void UnRegisterBehaviour(ObjPtr<Behaviour> behaviour);
 
+		// 비활성 목록 추가/제거 (제거는 마지막 원소와 바꿔서 O(1))
+		void AddInactive(const ObjPtr<Behaviour>& behaviour);
+		void RemoveInactive(Behaviour& behaviour);
+		// 목록과 각 Behaviour의 관리 상태를 같이 비움
+		void ClearBehaviourLists();
+
+		// 스크립트별 비용 측정 (꺼져 있으면 브로드캐스트당 bool 검사 한번만 추가됨)
+		bool m_scriptProfiling = false;
+		size_t m_scriptTopN = 10;
+		std::unordered_map<std::string, ScriptMessageStats> m_scriptStats;
+
+		ScriptMessageStats& AcquireScriptStats(const std::string& messageName);
+		size_t AcquireScriptType(ScriptMessageStats& stats, Behaviour& behaviour);
+		void RecordScriptCall(ScriptMessageStats& stats, size_t typeIndex, Behaviour& behaviour, double ms);
+
+		bool HasMessage(const ObjPtr<Behaviour>& behaviour, const std::string& messageName) const
+		{
+			return behaviour->m_messages.find(messageName) != behaviour->m_messages.end();
+		}
+
+		// Behaviour 한번 호출을 감싸서 시간 측정 + 프로파일러 zone 기록
+		class MMMENGINE_API ScriptCallScope
+		{
+		public:
+			ScriptCallScope(ScriptMessageStats& stats, Behaviour& behaviour);
+			~ScriptCallScope();
+
+			ScriptCallScope(const ScriptCallScope&) = delete;
+			ScriptCallScope& operator=(const ScriptCallScope&) = delete;
+
+		private:
+			ScriptMessageStats& m_stats;
+			Behaviour& m_behaviour;
+			size_t m_typeIndex;
+			ProfileScope m_zone;
+			uint64_t m_startNs;
+		};
+
 	public:
 		// ExcutionOrder에 따라 Behaviour를 정렬하는 함수
 		void SortBehaviours();
@@ -37,12 +110,31 @@ namespace MMMEngine
 		// 비활성화된 Behaviour를 감지하는 함수
 		void DisableBehaviours();
 
+		// 활성 여부가 바뀌었을 수 있음을 알림 (GameObject::SetActive/SetParent, Behaviour::SetEnabled 에서 호출)
+		void NotifyActivationChanged(const ObjPtr<Behaviour>& behaviour);
+		size_t GetPendingActivationCount() const { return m_activationChanged.size(); }
+		// 이 값이 바뀌었으면 그 전에 비활성화된 Behaviour는 OnDisable까지 받은 상태 (ObjectPool 재사용 판단용)
+		uint32_t GetDisablePassCount() const { return m_disablePassCount; }
+
 		void BroadCastBehaviourMessage(const std::string& messageName);
 
 		// 매개변수 있는 브로드캐스트
 		template<typename... Args>
 		void BroadCastBehaviourMessage(const std::string& messageName, Args&&... args)
 		{
+			MMM_PROFILE_SCOPE_DYNAMIC(messageName);
+			if (m_scriptProfiling)
+			{
+				ScriptMessageStats& stats = AcquireScriptStats(messageName);
+				for (auto& behaviour : m_activeBehaviours)
+				{
+					if (!HasMessage(behaviour, messageName)) continue;
+					ScriptCallScope scope(stats, *behaviour);
+					behaviour->CallMessage(messageName, std::forward<Args>(args)...);
+				}
+				return;
+			}
+
 			for (auto& behaviour : m_activeBehaviours)
 			{
 				behaviour->CallMessage(messageName, std::forward<Args>(args)...);
@@ -67,6 +159,7 @@ namespace MMMEngine
 		template<typename... Args>
 		void AllBroadCastBehaviourMessage(const std::string& messageName, Args&&... args)
 		{
+			MMM_PROFILE_SCOPE_DYNAMIC(messageName);
 			for (auto& behaviour : m_activeBehaviours)
 			{
 				behaviour->CallMessage(messageName, std::forward<Args>(args)...);
@@ -78,6 +171,21 @@ namespace MMMEngine
 		}
 
 		void CheckAndSortBehaviours();
+
+		// 스크립트 비용 측정
+		// 켜져 있는 동안 BroadCastBehaviourMessage 호출을 스크립트 타입별로 누적하고
+		// 프로파일러가 기록중이면 "타입::메시지" zone도 남김
+		void SetScriptProfiling(bool enabled);
+		bool IsScriptProfiling() const { return m_scriptProfiling; }
+		void SetScriptProfileTopN(size_t topN) { m_scriptTopN = topN; }
+		void ResetScriptProfile() { m_scriptStats.clear(); }
+		const std::unordered_map<std::string, ScriptMessageStats>& GetScriptProfile() const { return m_scriptStats; }
+		// 메시지별로 누적 시간이 큰 타입 순 + 느린 인스턴스 상위 topN개를 텍스트로 출력 (에디터 콘솔은 std::cout을 받음)
+		void DumpScriptProfile(std::ostream& out) const;
+
+		size_t GetActiveBehaviourCount() const { return m_activeBehaviours.size(); }
+		size_t GetInactiveBehaviourCount() const { return m_inactiveBehaviours.size(); }
+
 		bool StartUp(const std::string& userScriptsDLLPath);
 		void ShutDown();
 	};
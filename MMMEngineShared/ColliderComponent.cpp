@@ -4,6 +4,7 @@
 #include "Transform.h"
 #include "GameObject.h"
 #include "PhysxHelper.h"
+#include "PhysicsFilter.h"
 #include "rttr/registration"
 
 RTTR_REGISTRATION
@@ -11,36 +12,70 @@ RTTR_REGISTRATION
     using namespace rttr;
     using namespace MMMEngine;
 
+    registration::enumeration<ColliderComponent::CombineMode>("ColliderCombineMode")
+        (
+            rttr::value("Average", ColliderComponent::CombineMode::Average),
+            rttr::value("Min", ColliderComponent::CombineMode::Min),
+            rttr::value("Multiply", ColliderComponent::CombineMode::Multiply),
+            rttr::value("Max", ColliderComponent::CombineMode::Max)
+        );
+
     registration::class_<ColliderComponent>("ColliderComponent")
         (rttr::metadata("INSPECTOR", "DONT_ADD_COMP"))
         .property("StaticFriction", &ColliderComponent::GetStaticFriction, &ColliderComponent::SetStaticFriction)
         .property("DynamicFriction", &ColliderComponent::GetDynamicFriction, &ColliderComponent::SetDynamicFriction)
-        .property("Restitution", &ColliderComponent::GetRestitution, &ColliderComponent::SetRestitution);
+        .property("Restitution", &ColliderComponent::GetRestitution, &ColliderComponent::SetRestitution)
+        .property("FrictionCombine", &ColliderComponent::GetFrictionCombine, &ColliderComponent::SetFrictionCombine)
+        .property("RestitutionCombine", &ColliderComponent::GetRestitutionCombine, &ColliderComponent::SetRestitutionCombine)
+        .property("ContactDetails", &ColliderComponent::GetContactDetails, &ColliderComponent::SetContactDetails);
 }
 
 
 void MMMEngine::ColliderComponent::EnsureMaterial()
 {
-	auto& physics = MMMEngine::PhysicX::Get().GetPhysics();
-	if (!m_Material)
-	{
-		m_Material = physics.createMaterial(m_StaticFriction, m_DynamicFriction, m_Restitution);
-		m_MaterialOwned = true;
-	}
+	if (m_Material) return;
+
+	PhysicsMaterialDesc desc;
+	desc.staticFriction = m_StaticFriction;
+	desc.dynamicFriction = m_DynamicFriction;
+	desc.restitution = m_Restitution;
+	desc.frictionCombine = static_cast<physx::PxCombineMode::Enum>(m_FrictionCombine);
+	desc.restitutionCombine = static_cast<physx::PxCombineMode::Enum>(m_RestitutionCombine);
+
+	auto& physicx = MMMEngine::PhysicX::Get();
+	m_MaterialID = physicx.RegisterMaterial(desc);
+	m_Material = physicx.GetMaterial(m_MaterialID);
+}
+
+void MMMEngine::ColliderComponent::ReleaseMaterialRef()
+{
+	if (m_MaterialID != 0)
+		MMMEngine::PhysicX::Get().ReleaseMaterial(m_MaterialID);
+	m_MaterialID = 0;
+	m_Material = nullptr;
 }
 
 void MMMEngine::ColliderComponent::ApplyMaterial()
 {
-	EnsureMaterial();
-	if (!m_Material) return;
-	m_Material->setStaticFriction(m_StaticFriction);
-	m_Material->setDynamicFriction(m_DynamicFriction);
-	m_Material->setRestitution(m_Restitution);
-	if (m_Shape)
+	//shape가 없으면 (역직렬화 중 등) 값만 바꿔두고 BuildShape 때 EnsureMaterial로 한번만 찾음
+	if (!m_Shape)
 	{
-		physx::PxMaterial* mats[1] = { m_Material };
-		m_Shape->setMaterials(mats, 1);
+		ReleaseMaterialRef();
+		return;
 	}
+
+	//공유 머티리얼이라 값을 직접 바꾸지 않고, 바뀐 값으로 다시 찾아서 교체 (새 참조를 먼저 잡고 이전 참조 해제)
+	const uint32_t prevID = m_MaterialID;
+	m_MaterialID = 0;
+	m_Material = nullptr;
+	EnsureMaterial();
+
+	if (prevID != 0)
+		MMMEngine::PhysicX::Get().ReleaseMaterial(prevID);
+
+	if (!m_Material) return;
+	physx::PxMaterial* mats[1] = { m_Material };
+	m_Shape->setMaterials(mats, 1);
 }
 
 void MMMEngine::ColliderComponent::SetStaticFriction(float value)
@@ -64,6 +99,18 @@ void MMMEngine::ColliderComponent::SetRestitution(float value)
 	ApplyMaterial();
 }
 
+void MMMEngine::ColliderComponent::SetFrictionCombine(CombineMode mode)
+{
+	m_FrictionCombine = mode;
+	ApplyMaterial();
+}
+
+void MMMEngine::ColliderComponent::SetRestitutionCombine(CombineMode mode)
+{
+	m_RestitutionCombine = mode;
+	ApplyMaterial();
+}
+
 void MMMEngine::ColliderComponent::ApplySceneQueryFlag()
 {
     if (!m_Shape) return;
@@ -72,6 +119,7 @@ void MMMEngine::ColliderComponent::ApplySceneQueryFlag()
 
     if (m_Mode == ShapeMode::Disabled) query = false;
     if (m_Mode == ShapeMode::QueryOnly) query = true;
+    if (m_GeometryMissing) query = false;
 
     m_Shape->setFlag(physx::PxShapeFlag::eSCENE_QUERY_SHAPE, query);
 }
@@ -100,6 +148,13 @@ void MMMEngine::ColliderComponent::ApplyShapeModeFlags()
 {
     if (!m_Shape) return;
 
+    if (m_GeometryMissing)
+    {
+        m_Shape->setFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, false);
+        m_Shape->setFlag(physx::PxShapeFlag::eTRIGGER_SHAPE, false);
+        return;
+    }
+
     switch (m_Mode)
     {
     case ShapeMode::Simulation:
@@ -247,7 +302,19 @@ void MMMEngine::ColliderComponent::SetSceneQueryEnabled(bool on)
 
 void MMMEngine::ColliderComponent::SetFilterData(const physx::PxFilterData& sim, const physx::PxFilterData& query)
 {
-    m_SimFilter = sim; m_QueryFilter = query; ApplyAll();
+    m_SimFilter = sim; m_QueryFilter = query;
+    if (m_ContactDetails) m_SimFilter.word2 |= SIMFILTER_CONTACT_DETAILS;
+    else m_SimFilter.word2 &= ~SIMFILTER_CONTACT_DETAILS;
+    ApplyAll();
+}
+
+void MMMEngine::ColliderComponent::SetContactDetails(bool on)
+{
+    if (m_ContactDetails == on) return;
+    m_ContactDetails = on;
+
+    // pair flag는 필터 셰이더에서 정해지니 필터 재적용 + resetFiltering 필요
+    MarkFilterDirty();
 }
 
 void MMMEngine::ColliderComponent::MarkFilterDirty()
@@ -381,12 +448,7 @@ void MMMEngine::ColliderComponent::UnInitialize()
         m_Owned = false;
     }
 
-    if (m_Material && m_MaterialOwned)
-    {
-        m_Material->release();
-    }
-    m_Material = nullptr;
-    m_MaterialOwned = false;
+    ReleaseMaterialRef();
 }
 
 void MMMEngine::ColliderComponent::DetachShapeFromActor()
@@ -18,8 +18,7 @@ namespace MMMEngine
 		{
 			if (m_Shape && m_Owned) { m_Shape->release(); }
 			m_Shape = nullptr;
-			if (m_Material && m_MaterialOwned) { m_Material->release(); }
-			m_Material = nullptr;
+			ReleaseMaterialRef();
 		};
 
 		enum class ShapeMode : uint8_t
@@ -30,6 +29,15 @@ namespace MMMEngine
 			Disabled      // 아무것도 안 함(임시로 끄기용)
 		};
 
+		// 두 콜라이더의 마찰/반발 계수를 합치는 방식 (PxCombineMode와 같은 순서, 둘 중 우선순위가 높은 쪽을 사용)
+		enum class CombineMode : uint8_t
+		{
+			Average,
+			Min,
+			Multiply,
+			Max
+		};
+
 		// 콜라이더 종류별로 shape 만드는 가상함수
 		virtual void BuildShape(physx::PxPhysics* physics, physx::PxMaterial* material) = 0;
 
@@ -49,6 +57,10 @@ namespace MMMEngine
 		void SetStaticFriction(float value);
 		void SetDynamicFriction(float value);
 		void SetRestitution(float value);
+		CombineMode GetFrictionCombine() const { return m_FrictionCombine; }
+		CombineMode GetRestitutionCombine() const { return m_RestitutionCombine; }
+		void SetFrictionCombine(CombineMode mode);
+		void SetRestitutionCombine(CombineMode mode);
 		physx::PxMaterial* GetPxMaterial() const { return m_Material; }
 
 
@@ -66,6 +78,10 @@ namespace MMMEngine
 		void SetSceneQueryEnabled(bool on);
 		void SetFilterData(const physx::PxFilterData& sim, const physx::PxFilterData& query);
 
+		//충돌 콜백에 법선/접촉점/침투깊이가 필요한지 (끄면 CollisionInfo의 해당 값은 0)
+		bool GetContactDetails() const { return m_ContactDetails; }
+		void SetContactDetails(bool on);
+
 
 		//overlayer 설정
 		void SetOverrideLayer(bool enable);
@@ -128,25 +144,36 @@ namespace MMMEngine
 
 		void ApplyShapeModeFlags();
 		void ApplyMaterial();
+		// shape를 만들 때 현재 값으로 레지스트리 머티리얼을 참조 (이미 있으면 그대로)
 		void EnsureMaterial();
+		void ReleaseMaterialRef();
 
 		
 
 	protected:
 		physx::PxShape* m_Shape = nullptr;
+
+		//형상 데이터가 아직 없어서 임시 shape를 쓰는 중 (메시 콜라이더) //true면 충돌/쿼리에서 빠짐
+		bool m_GeometryMissing = false;
 		bool m_Owned = true;
+		//PhysicX 레지스트리의 공유 머티리얼 (같은 값의 콜라이더끼리 같이 씀, 참조 카운트는 m_MaterialID 기준)
 		physx::PxMaterial* m_Material = nullptr;
-		bool m_MaterialOwned = true;
+		uint32_t m_MaterialID = 0;
 
 		float m_StaticFriction = 0.5f;
 		float m_DynamicFriction = 0.5f;
 		float m_Restitution = 0.0f;
+		CombineMode m_FrictionCombine = CombineMode::Average;
+		CombineMode m_RestitutionCombine = CombineMode::Average;
 
 		ShapeMode m_Mode = ShapeMode::Simulation;
 		//이 shape가 Scene Query시스템에 포함될지 정함
 		//Raycast, Sweep, Overlap 등에 포함될지
 		bool m_SceneQueryEnabled = false;
 
+		//contact point 추출 여부 (sim filter word2에 반영)
+		bool m_ContactDetails = true;
+
 
 		//오프셋
 		physx::PxTransform m_LocalPose = physx::PxTransform(physx::PxIdentity);
@@ -0,0 +1,102 @@
+﻿#include "ConvexMeshColliderComponent.h"
+#include "rttr/registration"
+#include "PhysxManager.h"
+#include "PhysxHelper.h"
+#include "PhysicsMeshCache.h"
+#include "StaticMesh.h"
+
+RTTR_REGISTRATION
+{
+	using namespace rttr;
+	using namespace MMMEngine;
+
+	registration::class_<ConvexMeshColliderComponent>("ConvexMeshCollider")
+		(rttr::metadata("wrapper_type_name", "ObjPtr<ConvexMeshColliderComponent>"))
+		.property("Mesh", &ConvexMeshColliderComponent::GetMesh, &ConvexMeshColliderComponent::SetMesh)
+		.property("Scale", &ConvexMeshColliderComponent::GetScale, &ConvexMeshColliderComponent::SetScale)
+		.property("Center", &ColliderComponent::GetLocalCenter, &ColliderComponent::SetLocalCenter)
+		;
+
+	registration::class_<ObjPtr<ConvexMeshColliderComponent>>("ObjPtr<ConvexMeshColliderComponent>")
+		.constructor(
+			[]() {
+				return Object::NewObject<ConvexMeshColliderComponent>();
+			})
+		.method("Inject", &ObjPtr<ConvexMeshColliderComponent>::Inject);
+}
+
+void MMMEngine::ConvexMeshColliderComponent::SetMesh(ResPtr<StaticMesh>& mesh)
+{
+	if (m_mesh == mesh) return;
+	m_mesh = mesh;
+
+	// 임시 shape <-> 메시 shape 사이는 geometry 타입이 달라서 setGeometry로 못 바꿈 -> shape 재생성
+	if (m_Shape) PhysxManager::Get().NotifyColliderRebuild(this);
+}
+
+void MMMEngine::ConvexMeshColliderComponent::SetScale(Vector3 scale)
+{
+	if (m_scale == scale) return;
+	m_scale = scale;
+
+	if (m_Shape) MarkGeometryDirty();
+}
+
+bool MMMEngine::ConvexMeshColliderComponent::MakeGeometry(physx::PxConvexMeshGeometry& out) const
+{
+	if (!m_mesh) return false;
+
+	auto* mesh = PhysicsMeshCache::Get().GetConvexMesh(*m_mesh);
+	if (!mesh) return false;
+
+	out = physx::PxConvexMeshGeometry(mesh, physx::PxMeshScale(ToPxVec(m_scale)));
+	return out.isValid();
+}
+
+bool MMMEngine::ConvexMeshColliderComponent::UpdateShapeGeometry()
+{
+	if (!m_Shape) return false;
+
+	physx::PxGeometryHolder holder = m_Shape->getGeometry();
+	if (holder.getType() != physx::PxGeometryType::eCONVEXMESH) return false;
+
+	physx::PxConvexMeshGeometry geom;
+	if (!MakeGeometry(geom)) return false;
+
+	m_Shape->setGeometry(geom);
+	ApplyAll();
+	return true;
+}
+
+void MMMEngine::ConvexMeshColliderComponent::BuildShape(physx::PxPhysics* physics, physx::PxMaterial* material)
+{
+	if (!physics || !material) return;
+
+	physx::PxShape* shape = nullptr;
+
+	physx::PxConvexMeshGeometry geom;
+	if (MakeGeometry(geom))
+	{
+		m_GeometryMissing = false;
+		shape = physics->createShape(geom, *material, true);
+	}
+	else
+	{
+		// 메시가 없거나 쿠킹 실패 : 부착 흐름이 깨지지 않게 충돌/쿼리에서 빠진 임시 shape를 둠
+		m_GeometryMissing = true;
+		shape = physics->createShape(physx::PxSphereGeometry(0.01f), *material, true);
+	}
+	if (!shape) return;
+
+	SetShape(shape, true);
+}
+
+MMMEngine::ColliderComponent::DebugColliderShapeDesc MMMEngine::ConvexMeshColliderComponent::GetDebugShapeDesc() const
+{
+	DebugColliderShapeDesc s_Desc;
+	s_Desc.type = DebugColliderType::Unknown;
+
+	s_Desc.localCenter = ToVec(m_LocalPose.p);
+	s_Desc.localRotation = ToQuat(m_LocalPose.q);
+	return s_Desc;
+}
@@ -0,0 +1,33 @@
+﻿#pragma once
+#include "ColliderComponent.h"
+#include "ResourceManager.h"
+
+namespace MMMEngine
+{
+	class StaticMesh;
+
+	// StaticMesh로 쿠킹한 볼록 메시 콜라이더 (쿠킹 결과는 PhysicsMeshCache가 메시 내용 해시로 공유)
+	class MMMENGINE_API ConvexMeshColliderComponent : public ColliderComponent
+	{
+	private:
+		RTTR_ENABLE(Component)
+			RTTR_REGISTRATION_FRIEND
+	public:
+		ResPtr<StaticMesh>& GetMesh() { return m_mesh; }
+		void SetMesh(ResPtr<StaticMesh>& mesh);
+
+		Vector3 GetScale() const { return m_scale; }
+		void SetScale(Vector3 scale);
+
+		bool UpdateShapeGeometry() override;
+
+		void BuildShape(physx::PxPhysics* physics, physx::PxMaterial* material) override;
+
+		DebugColliderShapeDesc GetDebugShapeDesc() const override;
+	private:
+		ResPtr<StaticMesh> m_mesh = nullptr;
+		Vector3 m_scale = { 1.0f, 1.0f, 1.0f };
+
+		bool MakeGeometry(physx::PxConvexMeshGeometry& out) const;
+	};
+}
@@ -5,6 +5,7 @@
 #include "Transform.h"
 #include "ObjectManager.h"
 #include "SceneManager.h"
+#include "BehaviourManager.h"
 #include <cmath>
 
 uint64_t MMMEngine::GameObject::s_go_instanceID = 0;
@@ -70,15 +71,19 @@ void MMMEngine::GameObject::Initialize()
 
 void MMMEngine::GameObject::UpdateActiveInHierarchy()
 {
+	bool activeInHierarchy = m_active; // 부모가 없으면 자기 자신만 활성화 여부를 따짐
 	if (auto parent = m_transform->GetParent())
 	{
-		m_activeInHierarchy = parent->GetGameObject()->IsActiveInHierarchy() && m_active;
-	}
-	else
-	{
-		m_activeInHierarchy = m_active; // 부모가 없으면 자기 자신만 활성화 여부를 따짐
+		activeInHierarchy = parent->GetGameObject()->IsActiveInHierarchy() && m_active;
 	}
 
+	// 값이 그대로면 자식들도 바뀔 게 없으므로 전파하지 않음
+	if (activeInHierarchy == m_activeInHierarchy)
+		return;
+
+	m_activeInHierarchy = activeInHierarchy;
+	NotifyBehavioursActiveChanged();
+
 	// 자식들의 활성화 상태 갱신
 	for (auto& child : m_transform->m_childs)
 	{
@@ -87,6 +92,19 @@ void MMMEngine::GameObject::UpdateActiveInHierarchy()
 	}
 }
 
+void MMMEngine::GameObject::NotifyBehavioursActiveChanged()
+{
+	auto& behaviourManager = BehaviourManager::Get();
+	for (auto& comp : m_components)
+	{
+		if (!comp.IsValid())
+			continue;
+
+		if (auto behaviour = comp.Cast<Behaviour>())
+			behaviourManager.NotifyActivationChanged(behaviour);
+	}
+}
+
 MMMEngine::GameObject::GameObject() 
 {
 	std::string duplicateNum = "";
@@ -186,15 +204,24 @@ MMMEngine::ObjPtr<MMMEngine::Component> MMMEngine::GameObject::AddComponent(rttr
 		assert(false && "AddComponent : 컴포넌트가 아닙니다!");
 
 	// raw 타입에서 wrapper_type(ObjPtr<Derived>) 얻기
-	rttr::variant md = raw.get_metadata("wrapper_type_name");
-	if (!md.is_valid())
-		assert(false && "AddComponent : wrapper_type metadata가 없습니다!");
-
-	std::string wrapperTypeName = md.to_string();
-	rttr::type wrapperType = rttr::type::get_by_name(wrapperTypeName);
+	rttr::type wrapperType = GetComponentWrapperType(raw);
 	if (!wrapperType.is_valid())
 		assert(false && "AddComponent : wrapper_type이 유효하지 않습니다!");
 
+	return AddComponentByWrapperType(wrapperType);
+}
+
+rttr::type MMMEngine::GameObject::GetComponentWrapperType(rttr::type compType)
+{
+	rttr::variant md = compType.get_raw_type().get_metadata("wrapper_type_name");
+	if (!md.is_valid())
+		return rttr::type::get_by_name("");
+
+	return rttr::type::get_by_name(md.to_string());
+}
+
+MMMEngine::ObjPtr<MMMEngine::Component> MMMEngine::GameObject::AddComponentByWrapperType(const rttr::type& wrapperType)
+{
 	rttr::variant compVariant = wrapperType.create();
 	if (!compVariant.is_valid())
 		assert(false && "AddComponent : 컴포넌트가 생성되지 않았습니다!");
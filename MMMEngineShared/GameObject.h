@@ -36,6 +36,7 @@ namespace MMMEngine
 		void RegisterComponent(const ObjPtr<Component>& comp);
 		void UnRegisterComponent(const ObjPtr<Component>& comp);
 		void UpdateActiveInHierarchy();
+		void NotifyBehavioursActiveChanged();
 		void Initialize();
 		std::vector<ObjPtr<Component>> GetComponentsCopy() { return m_components; }
 		void SetScene(const SceneRef& scene) { m_scene = scene; }
@@ -62,6 +63,11 @@ namespace MMMEngine
 
 		ObjPtr<Component> AddComponent(rttr::type compType);
 
+		// 컴포넌트 타입의 ObjPtr<Derived> 래퍼 타입 (메타데이터가 없으면 invalid type)
+		static rttr::type GetComponentWrapperType(rttr::type compType);
+		// 래퍼 타입을 미리 구해둔 경우 (Instantiate 클론 플랜) 타입 해석 없이 바로 생성해서 추가
+		ObjPtr<Component> AddComponentByWrapperType(const rttr::type& wrapperType);
+
 		template <typename T>
 		ObjPtr<T> AddComponent()
 		{
@@ -0,0 +1,117 @@
+﻿#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+
+DEFINE_SINGLETON(MMMEngine::JobSystem)
+
+MMMEngine::JobSystem::~JobSystem()
+{
+	ShutDown();
+}
+
+void MMMEngine::JobSystem::StartUp(unsigned int _threadCount)
+{
+	ShutDown();
+
+	if (_threadCount == 0)
+	{
+		unsigned int hw = std::thread::hardware_concurrency();
+		_threadCount = hw > 1 ? hw - 1 : 0;
+	}
+
+	m_isStopping = false;
+	m_workers.reserve(_threadCount);
+	for (unsigned int i = 0; i < _threadCount; ++i)
+		m_workers.emplace_back(&JobSystem::WorkerLoop, this);
+}
+
+void MMMEngine::JobSystem::ShutDown()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isStopping = true;
+	}
+	m_wakeCv.notify_all();
+
+	for (auto& worker : m_workers)
+	{
+		if (worker.joinable())
+			worker.join();
+	}
+	m_workers.clear();
+}
+
+bool MMMEngine::JobSystem::RunNextChunk()
+{
+	size_t chunk = m_nextChunk.fetch_add(1);
+	if (chunk >= m_chunkCount)
+		return false;
+
+	// 연속구간 분할 (앞쪽 청크가 나머지를 하나씩 더 가짐)
+	size_t base = m_jobCount / m_chunkCount;
+	size_t extra = m_jobCount % m_chunkCount;
+	size_t begin = chunk * base + std::min(chunk, extra);
+	size_t end = begin + base + (chunk < extra ? 1 : 0);
+
+	{
+		MMM_PROFILE_SCOPE("JobSystem::Chunk");
+		(*m_pJob)(begin, end, chunk);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_pendingChunks == 0)
+			m_doneCv.notify_all();
+	}
+	return true;
+}
+
+void MMMEngine::JobSystem::WorkerLoop()
+{
+	Profiler::Get().SetThreadName("JobWorker");
+
+	uint64_t seenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wakeCv.wait(lock, [&] { return m_isStopping || m_jobGeneration != seenGeneration; });
+			if (m_isStopping)
+				return;
+			seenGeneration = m_jobGeneration;
+		}
+
+		while (RunNextChunk()) {}
+	}
+}
+
+void MMMEngine::JobSystem::ParallelFor(size_t _count, size_t _minPerChunk, const RangeJob& _job)
+{
+	if (_count == 0)
+		return;
+
+	// 워커가 없거나 일이 적으면 분배 비용이 더 큼
+	if (m_workers.empty() || _count < std::max<size_t>(_minPerChunk, 1) * 2)
+	{
+		_job(0, _count, 0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pJob = &_job;
+		m_jobCount = _count;
+		m_chunkCount = GetChunkCount();
+		m_pendingChunks = m_chunkCount;
+		m_nextChunk = 0;
+		++m_jobGeneration;
+	}
+	m_wakeCv.notify_all();
+
+	// 메인 스레드도 참여
+	while (RunNextChunk()) {}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCv.wait(lock, [&] { return m_pendingChunks == 0; });
+	m_pJob = nullptr;
+}
@@ -0,0 +1,53 @@
+﻿#pragma once
+#include "ExportSingleton.hpp"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+namespace MMMEngine
+{
+	// 프레임 단위 병렬작업용 고정 워커 풀
+	// 메인 스레드도 청크 하나를 맡아서 같이 돌고, ParallelFor는 모든 청크가 끝나야 리턴함
+	class MMMENGINE_API JobSystem : public Utility::ExportSingleton<JobSystem>
+	{
+		friend class Utility::ExportSingleton<JobSystem>;
+	public:
+		// < begin, end, chunkIndex > (chunkIndex 는 0 ~ GetChunkCount()-1, 실행 스레드와 무관하게 고정)
+		using RangeJob = std::function<void(size_t, size_t, size_t)>;
+
+	private:
+		JobSystem() = default;
+		~JobSystem();
+
+		std::vector<std::thread> m_workers;
+		std::mutex m_mutex;
+		std::condition_variable m_wakeCv;
+		std::condition_variable m_doneCv;
+
+		const RangeJob* m_pJob = nullptr;
+		size_t m_jobCount = 0;
+		size_t m_chunkCount = 0;
+		std::atomic<size_t> m_nextChunk = 0;
+		size_t m_pendingChunks = 0;
+		uint64_t m_jobGeneration = 0;
+		bool m_isStopping = false;
+
+		void WorkerLoop();
+		bool RunNextChunk();
+
+	public:
+		// _threadCount == 0 이면 (하드웨어 스레드 - 1) 만큼 생성
+		void StartUp(unsigned int _threadCount = 0);
+		void ShutDown();
+
+		size_t GetWorkerCount() const { return m_workers.size(); }
+		size_t GetChunkCount() const { return m_workers.size() + 1; }
+
+		// [0, _count) 를 GetChunkCount() 개의 연속 구간으로 나눠 병렬 실행
+		// 항목이 _minPerChunk * 2 보다 적으면 메인 스레드에서 한번에 실행 (chunkIndex 0)
+		void ParallelFor(size_t _count, size_t _minPerChunk, const RangeJob& _job);
+	};
+}
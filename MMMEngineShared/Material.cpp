@@ -48,6 +48,7 @@ void MMMEngine::Material::AddProperty(const std::wstring _name, const PropertyVa
 {
 	// 없으면 생성, 있으면 갱신
 	m_properties[_name] = _value;
+	++m_version;
 }
 
 // 프로퍼티 갱신
@@ -60,6 +61,7 @@ void MMMEngine::Material::SetProperty(const std::wstring _name, const MMMEngine:
 	// 같은 타입이면 갱신
 	if (_value.index() == it->second.index()) {
 		it->second = _value;
+		++m_version;
 	}
 }
 
@@ -69,6 +71,7 @@ void MMMEngine::Material::RemoveProperty(const std::wstring& _name)
 	auto it = m_properties.find(_name);
 	if (it != m_properties.end()) {
 		m_properties.erase(it);
+		++m_version;
 	}
 }
 
@@ -89,6 +92,7 @@ void MMMEngine::Material::SetVShader(const ResPtr<VShader> _vShader)
 	if (!_vShader)
 		return;
 	m_pVShader = _vShader;
+	++m_version;
 }
 
 void MMMEngine::Material::SetPShader(const ResPtr<PShader> _pShader)
@@ -96,6 +100,7 @@ void MMMEngine::Material::SetPShader(const ResPtr<PShader> _pShader)
 	if (!_pShader)
 		return;
 	m_pPShader = _pShader;
+	++m_version;
 }
 
 MMMEngine::ResPtr<MMMEngine::VShader> MMMEngine::Material::GetVShader()
@@ -120,7 +125,7 @@ bool MMMEngine::Material::LoadFromFilePath(const std::wstring& _filePath)
 	MaterialSerializer::Get().UnSerealize(this, _filePath);
 
 	// 타입에 따라 프로퍼티 생성, 삭제
-	auto type = ShaderInfo::Get().GetShaderType(m_pPShader->GetFilePath());
+	auto type = ShaderInfo::Get().GetShaderType(m_pPShader.get());
 	ShaderInfo::Get().ConvertMaterialType(type, this);
 
 	return true;
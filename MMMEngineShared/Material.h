@@ -34,6 +34,14 @@ namespace MMMEngine {
 		ResPtr<VShader> m_pVShader;
 		ResPtr<PShader> m_pPShader;
 
+		// 렌더용 베이크 데이터 (m_version 이 바뀌면 ShaderInfo::BakeMaterial 에서 재생성)
+		uint64_t m_version = 0;
+		MaterialBinding m_binding;
+
+		// 프로퍼티 이름을 미리 핸들로 바꿔둔 목록 (m_version 이 바뀔때만 재생성)
+		std::vector<std::pair<PropertyHandle, const PropertyValue*>> m_propertyHandles;
+		uint64_t m_propertyHandlesVersion = UINT64_MAX;
+
 	public:
 		void AddProperty(const std::wstring _name, const PropertyValue& _value);
 		void SetProperty(const std::wstring _name, const PropertyValue& _value);
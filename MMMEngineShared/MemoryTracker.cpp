@@ -0,0 +1,111 @@
+﻿#include "MemoryTracker.h"
+#include "ResourceManager.h"
+#include "SceneManager.h"
+#include <algorithm>
+#include <cstdio>
+
+DEFINE_SINGLETON(MMMEngine::MemoryTracker)
+
+MMMEngine::MemoryTag MMMEngine::MemoryTracker::RegisterTag(const std::string& _name)
+{
+	std::lock_guard<std::mutex> lock(m_tagMutex);
+
+	if (auto it = m_tagLookup.find(_name); it != m_tagLookup.end())
+		return it->second;
+
+	const uint32_t index = m_tagCount.load(std::memory_order_relaxed);
+	if (index >= kMaxTags)
+		return INVALID_MEMORY_TAG;
+
+	m_tags[index].name = _name;
+	m_tagLookup.emplace(_name, index);
+	m_tagCount.store(index + 1, std::memory_order_release);
+	return index;
+}
+
+void MMMEngine::MemoryTracker::OnAlloc(MemoryTag _tag, size_t _bytes)
+{
+	if (_tag >= kMaxTags) return;
+
+	TagCounters& tag = m_tags[_tag];
+	const int64_t live = tag.liveBytes.fetch_add(static_cast<int64_t>(_bytes), std::memory_order_relaxed) + static_cast<int64_t>(_bytes);
+	tag.liveCount.fetch_add(1, std::memory_order_relaxed);
+	tag.totalAllocs.fetch_add(1, std::memory_order_relaxed);
+	tag.frameAllocs.fetch_add(1, std::memory_order_relaxed);
+
+	int64_t peak = tag.peakBytes.load(std::memory_order_relaxed);
+	while (live > peak && !tag.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+}
+
+void MMMEngine::MemoryTracker::OnFree(MemoryTag _tag, size_t _bytes)
+{
+	if (_tag >= kMaxTags) return;
+
+	TagCounters& tag = m_tags[_tag];
+	tag.liveBytes.fetch_sub(static_cast<int64_t>(_bytes), std::memory_order_relaxed);
+	tag.liveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void MMMEngine::MemoryTracker::BeginFrame()
+{
+	const uint32_t count = m_tagCount.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < count; ++i)
+		m_tags[i].lastFrameAllocs.store(m_tags[i].frameAllocs.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void MMMEngine::MemoryTracker::CollectTags(std::vector<MemoryTagStats>& _out) const
+{
+	_out.clear();
+
+	const uint32_t count = m_tagCount.load(std::memory_order_acquire);
+	_out.reserve(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const TagCounters& tag = m_tags[i];
+		MemoryTagStats stats;
+		stats.name = tag.name;
+		stats.liveBytes = tag.liveBytes.load(std::memory_order_relaxed);
+		stats.liveCount = tag.liveCount.load(std::memory_order_relaxed);
+		stats.peakBytes = tag.peakBytes.load(std::memory_order_relaxed);
+		stats.totalAllocs = tag.totalAllocs.load(std::memory_order_relaxed);
+		stats.frameAllocs = tag.lastFrameAllocs.load(std::memory_order_relaxed);
+		_out.push_back(std::move(stats));
+	}
+
+	std::sort(_out.begin(), _out.end(),
+		[](const MemoryTagStats& a, const MemoryTagStats& b) { return a.name < b.name; });
+}
+
+void MMMEngine::MemoryTracker::CollectReport(MemoryReport& _out) const
+{
+	CollectTags(_out.tags);
+	ResourceManager::Get().CollectMemoryStats(_out.resources);
+	_out.sceneSnapShotBytes = SceneManager::Get().GetSnapShotMemoryUsage();
+}
+
+void MMMEngine::MemoryTracker::DumpReport(std::ostream& _out) const
+{
+	MemoryReport report;
+	CollectReport(report);
+
+	char line[256];
+	_out << "[Memory] tags\n";
+	for (const auto& tag : report.tags)
+	{
+		std::snprintf(line, sizeof(line), "  %-40s live %10.1f KB (%lld)  peak %10.1f KB  allocs/frame %u\n",
+			tag.name.c_str(), tag.liveBytes / 1024.0, static_cast<long long>(tag.liveCount),
+			tag.peakBytes / 1024.0, tag.frameAllocs);
+		_out << line;
+	}
+
+	_out << "[Memory] resources\n";
+	for (const auto& res : report.resources)
+	{
+		std::snprintf(line, sizeof(line), "  %-40s %10.1f KB (%zu)\n",
+			res.typeName.c_str(), res.bytes / 1024.0, res.count);
+		_out << line;
+	}
+
+	std::snprintf(line, sizeof(line), "[Memory] scene snapshots %.1f KB\n", report.sceneSnapShotBytes / 1024.0);
+	_out << line;
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+#include "ExportSingleton.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 아래는 표준라이브러리 (std::)의 dll export경고를 없애기 위한코드 
+// EngineShared는 ABI가 유지됨이 보장되기때문에 4251경고에 대해 안전함
+#pragma warning(push)
+#pragma warning(disable: 4251)
+
+namespace MMMEngine
+{
+	using MemoryTag = uint32_t;
+	constexpr MemoryTag INVALID_MEMORY_TAG = UINT32_MAX;
+
+	struct MemoryTagStats
+	{
+		std::string name;
+		int64_t liveBytes = 0;
+		int64_t liveCount = 0;
+		int64_t peakBytes = 0;
+		uint64_t totalAllocs = 0;
+		uint32_t frameAllocs = 0;		// 직전 프레임 할당 횟수
+	};
+
+	// 리소스는 할당 시점이 아니라 리포트 시점에 캐시를 훑어서 집계 (shared_ptr 수명이라 해제 시점을 잡을 수 없음)
+	struct ResourceMemoryStats
+	{
+		std::string typeName;
+		size_t count = 0;
+		size_t bytes = 0;
+	};
+
+	struct MemoryReport
+	{
+		std::vector<MemoryTagStats> tags;			// 이름순
+		std::vector<ResourceMemoryStats> resources;	// 바이트 내림차순
+		size_t sceneSnapShotBytes = 0;				// 씬 json 스냅샷 추정치
+	};
+
+	// 태그별 메모리 추적
+	// 태그 등록만 락을 잡고 기록은 atomic만 쓰므로 워커 스레드(PhysX 등)에서 호출해도 됨
+	class MMMENGINE_API MemoryTracker : public Utility::ExportSingleton<MemoryTracker>
+	{
+		friend class Utility::ExportSingleton<MemoryTracker>;
+	public:
+		static constexpr size_t kMaxTags = 512;
+
+	private:
+		MemoryTracker() = default;
+		~MemoryTracker() = default;
+
+		struct TagCounters
+		{
+			std::string name;
+			std::atomic<int64_t> liveBytes{ 0 };
+			std::atomic<int64_t> liveCount{ 0 };
+			std::atomic<int64_t> peakBytes{ 0 };
+			std::atomic<uint64_t> totalAllocs{ 0 };
+			std::atomic<uint32_t> frameAllocs{ 0 };
+			std::atomic<uint32_t> lastFrameAllocs{ 0 };
+		};
+
+		// 기록중인 스레드가 있어도 재배치가 없도록 고정 배열
+		std::array<TagCounters, kMaxTags> m_tags;
+		std::atomic<uint32_t> m_tagCount{ 0 };
+		std::unordered_map<std::string, MemoryTag> m_tagLookup;
+		std::mutex m_tagMutex;
+
+	public:
+		// 이름이 같으면 같은 태그 반환 //슬롯이 다 차면 INVALID_MEMORY_TAG
+		MemoryTag RegisterTag(const std::string& _name);
+
+		void OnAlloc(MemoryTag _tag, size_t _bytes);
+		void OnFree(MemoryTag _tag, size_t _bytes);
+
+		// 메인 루프 시작마다 호출 (프레임당 할당 횟수 갱신)
+		void BeginFrame();
+
+		void CollectTags(std::vector<MemoryTagStats>& _out) const;
+		// 태그 + 리소스 캐시 + 씬 스냅샷 (메인 스레드에서 호출)
+		void CollectReport(MemoryReport& _out) const;
+		void DumpReport(std::ostream& _out) const;
+	};
+}
+
+#pragma warning(pop)
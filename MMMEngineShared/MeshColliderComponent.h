@@ -0,0 +1,34 @@
+﻿#pragma once
+#include "ColliderComponent.h"
+#include "ResourceManager.h"
+
+namespace MMMEngine
+{
+	class StaticMesh;
+
+	// StaticMesh로 쿠킹한 삼각형 메시 콜라이더 (쿠킹 결과는 PhysicsMeshCache가 메시 내용 해시로 공유)
+	// PhysX 제약으로 Static 또는 키네마틱 rigid에만 붙여야 함 (일반 Dynamic이면 ConvexMeshCollider 사용)
+	class MMMENGINE_API MeshColliderComponent : public ColliderComponent
+	{
+	private:
+		RTTR_ENABLE(Component)
+			RTTR_REGISTRATION_FRIEND
+	public:
+		ResPtr<StaticMesh>& GetMesh() { return m_mesh; }
+		void SetMesh(ResPtr<StaticMesh>& mesh);
+
+		Vector3 GetScale() const { return m_scale; }
+		void SetScale(Vector3 scale);
+
+		bool UpdateShapeGeometry() override;
+
+		void BuildShape(physx::PxPhysics* physics, physx::PxMaterial* material) override;
+
+		DebugColliderShapeDesc GetDebugShapeDesc() const override;
+	private:
+		ResPtr<StaticMesh> m_mesh = nullptr;
+		Vector3 m_scale = { 1.0f, 1.0f, 1.0f };
+
+		bool MakeGeometry(physx::PxTriangleMeshGeometry& out) const;
+	};
+}
@@ -47,12 +47,30 @@ void MMMEngine::MeshRenderer::Init()
 	
 }
 
+void MMMEngine::MeshRenderer::PrepareRender()
+{
+	if (!mesh || !GetTransform())
+		return;
+
+	// 월드매트릭스 더티 해제, 쉐이더 타입핸들 캐싱 (워커에서 쓰기 발생 방지)
+	GetTransform()->GetWorldMatrix();
+	for (auto& [matIdx, meshIndices] : mesh->meshGroupData)
+	{
+		auto& material = mesh->materials[matIdx];
+		if (material)
+			ShaderInfo::Get().GetRenderType(material->GetPShader().get());
+	}
+}
+
 void MMMEngine::MeshRenderer::Render()
 {
 	// 유효성 확인
 	if (!mesh || !GetTransform())
 		return;
 
+	// 서브메시들은 같은 월드매트릭스 슬롯 공유
+	int worldMatIndex = RenderManager::Get().AddMatrix(GetTransform()->GetWorldMatrix());
+
 	for (auto& [matIdx, meshIndices] : mesh->meshGroupData) {
 		auto& material = mesh->materials[matIdx];
 
@@ -64,15 +82,14 @@ void MMMEngine::MeshRenderer::Render()
 			command.vertexBuffer = meshBuffer.Get();
 			command.indexBuffer = indicesBuffer.Get();
 			command.material = material;
-			command.worldMatIndex = RenderManager::Get().AddMatrix(GetTransform()->GetWorldMatrix());
+			command.worldMatIndex = worldMatIndex;
 			command.indiciesSize = mesh->indexSizes[idx];
 			command.rendererID = renderIndex;
 
 			// TODO::CamDistance 보내줘야함!!
 			command.camDistance = 0.0f;
 
-			std::wstring shaderPath = material->GetPShader()->GetFilePath();
-			RenderType type = ShaderInfo::Get().GetRenderType(shaderPath);
+			RenderType type = ShaderInfo::Get().GetRenderType(material->GetPShader().get());
 
 			RenderManager::Get().AddCommand(type, std::move(command));
 		}
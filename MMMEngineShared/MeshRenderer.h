@@ -18,6 +18,8 @@ namespace MMMEngine {
 		void UnInitialize() override;
 		void Init() override;
 		void Render() override;
+		bool IsParallelRenderable() const override { return true; }
+		void PrepareRender() override;
 	public:
 		ResPtr<StaticMesh>& GetMesh() { return mesh; }
 		void SetMesh(ResPtr<StaticMesh>& _mesh);
@@ -10,6 +10,8 @@
 #include <iostream>
 #include <unordered_map>
 #include <vector>
+#include <memory>
+#include <algorithm>
 #include "Transform.h"
 #include "SceneManager.h"
 
@@ -50,8 +52,6 @@ namespace
 	struct CloneContext
 	{
 		std::unordered_map<const Object*, ObjPtr<Object>> objectMap;
-		std::vector<std::pair<ObjPtr<Component>, ObjPtr<Component>>> componentPairs;
-		std::vector<std::pair<ObjPtr<Transform>, ObjPtr<Transform>>> transformPairs;
 	};
 
 	void CollectHierarchy(const ObjPtr<GameObject>& root, std::vector<ObjPtr<GameObject>>& out)
@@ -90,18 +90,6 @@ namespace
 		}
 	}
 
-	ObjPtr<Transform> FindMappedTransform(const CloneContext& ctx, const ObjPtr<Transform>& original)
-	{
-		if (!original.IsValid())
-			return ObjPtr<Transform>();
-
-		auto it = ctx.objectMap.find(original.operator->());
-		if (it == ctx.objectMap.end())
-			return ObjPtr<Transform>();
-
-		return it->second.Cast<Transform>();
-	}
-
 	rttr::variant CloneVariant(const rttr::variant& src, const rttr::type& targetType, const CloneContext& ctx);
 
 	void CloneObject(rttr::instance srcObj, rttr::instance dstObj, const CloneContext& ctx)
@@ -162,8 +150,9 @@ namespace
 
 		if (targetType.get_name().to_string().find("ObjPtr") != std::string::npos)
 		{
+			// 래퍼 타입 생성자는 새 오브젝트를 만들기 때문에 원본 값이 같은 타입이면 그 복사본에 주입
 			auto inject = targetType.get_method("Inject");
-			rttr::variant target = targetType.create();
+			rttr::variant target = (src.get_type() == targetType) ? src : targetType.create();
 			if (!inject.is_valid() || !target.is_valid())
 				return rttr::variant();
 
@@ -271,99 +260,392 @@ namespace
 		return target;
 	}
 
-	ObjPtr<GameObject> CreateCloneShallow(const ObjPtr<GameObject>& original, CloneContext& ctx)
+	// ---- 클론 플랜 ----
+	// 같은 원본을 반복해서 Instantiate 할 때 rttr 프로퍼티 순회/컴포넌트 타입 해석을 매번 다시 하지 않도록
+	// 원본 계층 구조(노드/컴포넌트 평면 목록, 래퍼 타입, 프로퍼티 복사 방식, 참조 대상 슬롯)를 한번 만들어 캐시함
+	// 프로퍼티 값은 매번 원본에서 읽고, 구조(노드/컴포넌트 구성, 부모 관계)가 바뀐 경우에만 다시 만듦
+
+	enum class CloneOpKind : uint8_t
 	{
-		if (!original.IsValid() || original->IsDestroyed())
-			return ObjPtr<GameObject>();
+		Copy,		// 값 그대로 (산술/enum/문자열/MUID/참조가 없는 구조체)
+		ObjectRef,	// ObjPtr : 계층 안을 가리키면 복제본으로 바꿔서 주입
+		Deep,		// 컨테이너/참조를 품은 구조체 : CloneVariant 로 재귀 복제
+	};
+
+	struct CloneOp
+	{
+		rttr::property prop;
+		rttr::method inject;
+		CloneOpKind kind;
+		// 플랜을 만들 때 참조하던 대상과 그 슬롯 (값이 그대로면 조회 없이 바로 씀, -1 은 계층 밖)
+		const Object* cachedTarget;
+		int32_t cachedSlot;
+	};
+
+	struct CloneComponentPlan
+	{
+		ObjPtr<Component> source;
+		uint32_t slot;
+		rttr::type wrapperType;
+		std::vector<CloneOp> ops;
+		bool missingScript;
+	};
+
+	struct CloneNodePlan
+	{
+		ObjPtr<GameObject> source;
+		int32_t parentNode;				// 계층 안 부모 노드 (-1 이면 복제 루트)
+		uint32_t goSlot;
+		uint32_t transformSlot;
+		uint32_t firstComponent;		// components 범위 (생성 순서, RigidBody 먼저)
+		uint32_t componentCount;
+		uint32_t firstSourceComponent;	// sourceComponents 범위 (원본 m_components 순서, 구조 비교용)
+		uint32_t sourceComponentCount;
+	};
 
-		SceneRef sceneRef = original->GetScene();
-		ObjPtr<GameObject> clone = Object::NewObject<GameObject>(sceneRef, original->GetName());
+	struct ClonePlan
+	{
+		std::vector<CloneNodePlan> nodes;	// CollectHierarchy 순서 (부모가 항상 앞)
+		std::vector<CloneComponentPlan> components;
+		std::vector<ObjPtr<Component>> sourceComponents;
+		std::unordered_map<const Object*, uint32_t> slotOf;	// 원본 오브젝트 -> 슬롯
+		uint32_t slotCount = 0;
+		bool hasDeepOps = false;
+	};
+
+	struct ClonePlanCache
+	{
+		std::unordered_map<ObjPtr<GameObject>, std::shared_ptr<ClonePlan>> plans;
+		size_t purgeThreshold = 64;
+	};
+
+	ClonePlanCache& GetClonePlanCache()
+	{
+		static ClonePlanCache s_cache;
+		return s_cache;
+	}
+
+	bool IsClonableComponent(const ObjPtr<Component>& comp)
+	{
+		return comp.IsValid() && !comp->IsDestroyed() && !comp.Cast<Transform>();
+	}
+
+	const auto kClonePropertyFilter =
+		rttr::filter_item::instance_item |
+		rttr::filter_item::public_access |
+		rttr::filter_item::non_public_access;
+
+	// CloneVariant 와 같은 분기 순서로 분류 (프로퍼티만 있는 구조체는 하위가 전부 Copy 면 통째로 복사)
+	CloneOpKind ClassifyCloneType(const rttr::type& t, int depth = 0)
+	{
+		if (t.is_enumeration() || t.is_arithmetic())
+			return CloneOpKind::Copy;
 
-		if (auto sceneRaw = SceneManager::Get().GetSceneRaw(sceneRef))
-			sceneRaw->RegisterGameObject(clone);
+		if (t == type::get<std::string>() || t == type::get<MMMEngine::Utility::MUID>())
+			return CloneOpKind::Copy;
 
-		clone->SetName(original->GetName());
-		clone->SetTag(original->GetTag());
-		clone->SetLayer(original->GetLayer());
-		clone->SetActive(original->IsActiveSelf());
+		if (t.get_name().to_string().find("ObjPtr") != std::string::npos)
+			return depth == 0 ? CloneOpKind::ObjectRef : CloneOpKind::Deep;
+
+		if (t.is_sequential_container() || t.is_associative_container())
+			return CloneOpKind::Deep;
+
+		if (t.is_wrapper())
+			return CloneOpKind::Copy;
+
+		auto props = t.get_properties(kClonePropertyFilter);
+		if (props.begin() == props.end())
+			return CloneOpKind::Copy;
 
-		ctx.objectMap.emplace(original.operator->(), ObjPtr<Object>(clone));
+		if (depth >= 4)
+			return CloneOpKind::Deep;
 
-		auto origTr = original->GetTransform();
-		auto cloneTr = clone->GetTransform();
-		if (origTr.IsValid() && cloneTr.IsValid())
+		for (auto& prop : props)
 		{
-			ctx.objectMap.emplace(origTr.operator->(), ObjPtr<Object>(cloneTr));
-			ctx.transformPairs.emplace_back(origTr, cloneTr);
+			if (ClassifyCloneType(prop.get_type(), depth + 1) != CloneOpKind::Copy)
+				return CloneOpKind::Deep;
 		}
+		return CloneOpKind::Copy;
+	}
+
+	void BuildCloneOps(ClonePlan& plan, CloneComponentPlan& compPlan)
+	{
+		Component& src = *compPlan.source;
+		type t = rttr::type::get(src);
 
-		// RigidBody를 먼저 만들고, 그 다음 나머지 컴포넌트를 생성한다.
-		// Collider가 먼저 만들어지면 자동으로 RigidBody가 생성되어 복제값이 덮이는 문제 방지.
-		for (auto& comp : original->GetAllComponents())
+		for (auto& prop : t.get_properties(kClonePropertyFilter))
 		{
-			if (!comp.IsValid() || comp->IsDestroyed())
+			if (prop.is_readonly())
 				continue;
 
-			if (comp.Cast<Transform>())
+			if (prop.get_name() == "MUID")
 				continue;
 
-			rttr::type compType = rttr::type::get(*comp);
-			if (compType.get_name().to_string() != "RigidBodyComponent")
-				continue;
+			const rttr::type propType = prop.get_type();
+			CloneOp op{ prop, propType.get_method("Inject"), ClassifyCloneType(propType), nullptr, -1 };
 
-			ObjPtr<Component> clonedComp = clone->AddComponent(compType);
-			if (!clonedComp.IsValid())
-				continue;
+			if (op.kind == CloneOpKind::ObjectRef)
+			{
+				rttr::variant value = prop.get_value(src);
+				Object* raw = nullptr;
+				if (!op.inject.is_valid() || value.get_type() != propType)
+				{
+					op.kind = CloneOpKind::Deep;
+				}
+				else if (value.convert(raw) && raw)
+				{
+					op.cachedTarget = raw;
+					auto it = plan.slotOf.find(raw);
+					if (it != plan.slotOf.end())
+						op.cachedSlot = static_cast<int32_t>(it->second);
+				}
+			}
 
-			ctx.objectMap.emplace(comp.operator->(), ObjPtr<Object>(clonedComp));
-			ctx.componentPairs.emplace_back(comp, clonedComp);
+			if (op.kind == CloneOpKind::Deep)
+				plan.hasDeepOps = true;
+
+			compPlan.ops.push_back(std::move(op));
 		}
+	}
+
+	std::shared_ptr<ClonePlan> BuildClonePlan(const std::vector<ObjPtr<GameObject>>& originals)
+	{
+		auto plan = std::make_shared<ClonePlan>();
+		plan->nodes.reserve(originals.size());
+
+		std::unordered_map<const Object*, int32_t> nodeOfTransform;
+		auto addSlot = [&plan](const Object* raw)
+			{
+				const uint32_t slot = plan->slotCount++;
+				plan->slotOf.emplace(raw, slot);
+				return slot;
+			};
 
-		for (auto& comp : original->GetAllComponents())
+		// 1. 노드/컴포넌트 평면 목록 + 슬롯 배정
+		for (auto& go : originals)
 		{
-			if (!comp.IsValid() || comp->IsDestroyed())
-				continue;
+			auto tr = go->GetTransform();
 
-			if (comp.Cast<Transform>())
-				continue;
+			CloneNodePlan node{};
+			node.source = go;
+			node.parentNode = -1;
+			if (auto parent = tr->GetParent(); parent.IsValid())
+			{
+				auto it = nodeOfTransform.find(parent.operator->());
+				if (it != nodeOfTransform.end())
+					node.parentNode = it->second;
+			}
 
-			rttr::type compType = rttr::type::get(*comp);
-			if (compType.get_name().to_string() == "RigidBodyComponent")
-				continue;
+			node.goSlot = addSlot(go.operator->());
+			node.transformSlot = addSlot(tr.operator->());
+			nodeOfTransform.emplace(tr.operator->(), static_cast<int32_t>(plan->nodes.size()));
 
-			ObjPtr<Component> clonedComp = clone->AddComponent(compType);
-			if (!clonedComp.IsValid())
-				continue;
+			node.firstSourceComponent = static_cast<uint32_t>(plan->sourceComponents.size());
+			for (auto& comp : go->GetAllComponents())
+			{
+				if (IsClonableComponent(comp))
+					plan->sourceComponents.push_back(comp);
+			}
+			node.sourceComponentCount = static_cast<uint32_t>(plan->sourceComponents.size()) - node.firstSourceComponent;
+
+			// RigidBody를 먼저 만들고, 그 다음 나머지 컴포넌트를 생성한다.
+			// Collider가 먼저 만들어지면 자동으로 RigidBody가 생성되어 복제값이 덮이는 문제 방지.
+			node.firstComponent = static_cast<uint32_t>(plan->components.size());
+			for (int pass = 0; pass < 2; ++pass)
+			{
+				for (uint32_t i = 0; i < node.sourceComponentCount; ++i)
+				{
+					const auto& comp = plan->sourceComponents[node.firstSourceComponent + i];
+					rttr::type compType = rttr::type::get(*comp);
+					const bool isRigidBody = compType.get_name() == "RigidBodyComponent";
+					if (isRigidBody != (pass == 0))
+						continue;
+
+					rttr::type wrapperType = GameObject::GetComponentWrapperType(compType);
+					if (!wrapperType.is_valid())
+						continue;
+
+					plan->components.push_back({ comp, addSlot(comp.operator->()), wrapperType, {},
+						comp.Cast<MissingScriptBehaviour>().IsValid() });
+				}
+			}
+			node.componentCount = static_cast<uint32_t>(plan->components.size()) - node.firstComponent;
+
+			plan->nodes.push_back(node);
+		}
+
+		// 2. 프로퍼티 복사 목록 (참조 슬롯을 미리 풀어두려면 슬롯 배정이 끝나야 함)
+		for (auto& compPlan : plan->components)
+			BuildCloneOps(*plan, compPlan);
+
+		return plan;
+	}
+
+	// 원본 계층이 플랜을 만들 때와 같은 구조인지 (노드 순서, 부모, 컴포넌트 구성)
+	bool IsClonePlanValid(const ClonePlan& plan, const std::vector<ObjPtr<GameObject>>& originals)
+	{
+		if (originals.size() != plan.nodes.size())
+			return false;
+
+		for (size_t i = 0; i < originals.size(); ++i)
+		{
+			const CloneNodePlan& node = plan.nodes[i];
+			const auto& go = originals[i];
+			if (go != node.source)
+				return false;
+
+			if (node.parentNode >= 0
+				&& go->GetTransform()->GetParent() != plan.nodes[node.parentNode].source->GetTransform())
+				return false;
+
+			uint32_t count = 0;
+			for (auto& comp : go->GetAllComponents())
+			{
+				if (!IsClonableComponent(comp))
+					continue;
+
+				if (count >= node.sourceComponentCount
+					|| comp != plan.sourceComponents[node.firstSourceComponent + count])
+					return false;
+				++count;
+			}
+
+			if (count != node.sourceComponentCount)
+				return false;
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<ClonePlan> AcquireClonePlan(const ObjPtr<GameObject>& original, const std::vector<ObjPtr<GameObject>>& originals)
+	{
+		auto& cache = GetClonePlanCache();
+
+		auto it = cache.plans.find(original);
+		if (it != cache.plans.end() && IsClonePlanValid(*it->second, originals))
+			return it->second;
+
+		// 원본이 파괴된 플랜은 캐시가 커졌을 때만 모아서 정리
+		if (it == cache.plans.end() && cache.plans.size() >= cache.purgeThreshold)
+		{
+			for (auto purgeIt = cache.plans.begin(); purgeIt != cache.plans.end();)
+			{
+				if (!purgeIt->first.IsValid() || purgeIt->first->IsDestroyed())
+					purgeIt = cache.plans.erase(purgeIt);
+				else
+					++purgeIt;
+			}
+			cache.purgeThreshold = std::max<size_t>(64, cache.plans.size() * 2);
+		}
+
+		auto plan = BuildClonePlan(originals);
+		cache.plans[original] = plan;
+		return plan;
+	}
+
+	void ApplyCloneOp(const CloneOp& op, const ClonePlan& plan, Component& src, Component& dst,
+		const std::vector<ObjPtr<Object>>& slots, const CloneContext& ctx)
+	{
+		rttr::variant value = op.prop.get_value(src);
+
+		switch (op.kind)
+		{
+		case CloneOpKind::Copy:
+			op.prop.set_value(dst, value);
+			break;
+
+		case CloneOpKind::ObjectRef:
+		{
+			// 원본 값(ObjPtr<T>) 복사본에 주입하므로 래퍼 타입의 생성자를 부르지 않음
+			ObjPtr<Object> mapped;
+			Object* raw = nullptr;
+			if (value.convert(raw) && raw && !raw->IsDestroyed())
+			{
+				int32_t slot = -1;
+				if (raw == op.cachedTarget)
+				{
+					slot = op.cachedSlot;
+				}
+				else if (auto it = plan.slotOf.find(raw); it != plan.slotOf.end())
+				{
+					slot = static_cast<int32_t>(it->second);
+				}
+
+				mapped = slot >= 0 ? slots[slot] : ObjectManager::Get().GetPtrFromRaw<Object>(raw);
+				if (!mapped.IsValid())
+					mapped = ObjPtr<Object>();
+			}
 
-			ctx.objectMap.emplace(comp.operator->(), ObjPtr<Object>(clonedComp));
-			ctx.componentPairs.emplace_back(comp, clonedComp);
+			const ObjPtrBase& ref = mapped;
+			op.inject.invoke(value, ref);
+			op.prop.set_value(dst, value);
+			break;
 		}
 
-		return clone;
+		case CloneOpKind::Deep:
+			op.prop.set_value(dst, CloneVariant(value, op.prop.get_type(), ctx));
+			break;
+		}
 	}
 
-	ObjPtr<GameObject> InstantiateGameObjectInternal(const ObjPtr<GameObject>& original, CloneContext& ctx)
+	struct CloneResult
+	{
+		std::shared_ptr<ClonePlan> plan;	// 실행 중에 스크립트가 같은 원본을 Instantiate 해서 플랜이 바뀌어도 유지
+		std::vector<ObjPtr<Object>> slots;
+	};
+
+	ObjPtr<GameObject> InstantiateGameObjectInternal(const ObjPtr<GameObject>& original, CloneResult& result)
 	{
 		std::vector<ObjPtr<GameObject>> originals;
 		CollectHierarchy(original, originals);
 		if (originals.empty())
 			return ObjPtr<GameObject>();
 
-		ObjPtr<GameObject> rootClone;
-		for (auto& go : originals)
+		result.plan = AcquireClonePlan(original, originals);
+		const ClonePlan& plan = *result.plan;
+		auto& slots = result.slots;
+		slots.assign(plan.slotCount, ObjPtr<Object>());
+
+		std::vector<ObjPtr<Transform>> cloneTransforms(plan.nodes.size());
+		std::vector<ObjPtr<Component>> cloneComponents(plan.components.size());
+
+		// 1. 게임오브젝트 + 컴포넌트 생성
+		for (size_t i = 0; i < plan.nodes.size(); ++i)
 		{
-			ObjPtr<GameObject> clone = CreateCloneShallow(go, ctx);
-			if (!clone.IsValid())
-				continue;
+			const CloneNodePlan& node = plan.nodes[i];
+			const auto& src = node.source;
+
+			SceneRef sceneRef = src->GetScene();
+			ObjPtr<GameObject> clone = Object::NewObject<GameObject>(sceneRef, src->GetName());
+
+			if (auto sceneRaw = SceneManager::Get().GetSceneRaw(sceneRef))
+				sceneRaw->RegisterGameObject(clone);
+
+			clone->SetTag(src->GetTag());
+			clone->SetLayer(src->GetLayer());
+			clone->SetActive(src->IsActiveSelf());
+
+			cloneTransforms[i] = clone->GetTransform();
+			slots[node.goSlot] = ObjPtr<Object>(clone);
+			slots[node.transformSlot] = ObjPtr<Object>(cloneTransforms[i]);
+
+			for (uint32_t c = node.firstComponent; c < node.firstComponent + node.componentCount; ++c)
+			{
+				const CloneComponentPlan& compPlan = plan.components[c];
+				ObjPtr<Component> cloned = clone->AddComponentByWrapperType(compPlan.wrapperType);
+				if (!cloned.IsValid())
+					continue;
 
-			if (go == original)
-				rootClone = clone;
+				cloneComponents[c] = cloned;
+				slots[compPlan.slot] = ObjPtr<Object>(cloned);
+			}
 		}
 
-		for (auto& pair : ctx.transformPairs)
+		// 2. 로컬 트랜스폼
+		for (size_t i = 0; i < plan.nodes.size(); ++i)
 		{
-			auto& srcTr = pair.first;
-			auto& dstTr = pair.second;
+			auto srcTr = plan.nodes[i].source->GetTransform();
+			auto& dstTr = cloneTransforms[i];
 			if (!srcTr.IsValid() || !dstTr.IsValid())
 				continue;
 
@@ -372,54 +654,54 @@ namespace
 			dstTr->SetLocalScale(srcTr->GetLocalScale());
 		}
 
-		for (auto& pair : ctx.componentPairs)
+		// 3. 컴포넌트 프로퍼티 (Deep 복사가 있을 때만 원본 -> 복제본 맵을 채움)
+		CloneContext ctx;
+		if (plan.hasDeepOps)
 		{
-			auto& srcComp = pair.first;
-			auto& dstComp = pair.second;
-			if (!srcComp.IsValid() || !dstComp.IsValid())
+			ctx.objectMap.reserve(plan.slotOf.size());
+			for (auto& [raw, slot] : plan.slotOf)
+			{
+				if (slots[slot].IsValid())
+					ctx.objectMap.emplace(raw, slots[slot]);
+			}
+		}
+
+		for (size_t c = 0; c < plan.components.size(); ++c)
+		{
+			const CloneComponentPlan& compPlan = plan.components[c];
+			auto& dstComp = cloneComponents[c];
+			if (!compPlan.source.IsValid() || !dstComp.IsValid())
 				continue;
 
-			CloneObject(*srcComp, *dstComp, ctx);
+			for (const CloneOp& op : compPlan.ops)
+				ApplyCloneOp(op, plan, *compPlan.source, *dstComp, slots, ctx);
 
-			auto missingSrc = srcComp.Cast<MissingScriptBehaviour>();
-			if (missingSrc.IsValid())
+			if (compPlan.missingScript)
 			{
+				auto missingSrc = compPlan.source.Cast<MissingScriptBehaviour>();
 				auto missingDst = dstComp.Cast<MissingScriptBehaviour>();
-				if (missingDst.IsValid())
+				if (missingSrc.IsValid() && missingDst.IsValid())
 					missingDst->SetOriginalPropsMsgPack(missingSrc->GetOriginalPropsMsgPack());
 			}
 		}
 
-		for (auto& go : originals)
+		// 4. 부모 연결 (전위 순서라 자식 순서가 원본과 같게 유지됨)
+		for (size_t i = 0; i < plan.nodes.size(); ++i)
 		{
-			if (!go.IsValid() || go->IsDestroyed())
-				continue;
-
-			auto origTr = go->GetTransform();
-			auto cloneTr = FindMappedTransform(ctx, origTr);
-			if (!cloneTr.IsValid())
+			const int32_t parentNode = plan.nodes[i].parentNode;
+			if (parentNode < 0)
 				continue;
 
-			const size_t childCount = origTr->GetChildCount();
-			for (size_t i = 0; i < childCount; ++i)
-			{
-				auto childTr = origTr->GetChild(i);
-				auto childCloneTr = FindMappedTransform(ctx, childTr);
-				if (!childCloneTr.IsValid())
-					continue;
-
-				childCloneTr->SetParent(cloneTr, false);
-			}
+			if (cloneTransforms[i].IsValid() && cloneTransforms[parentNode].IsValid())
+				cloneTransforms[i]->SetParent(cloneTransforms[parentNode], false);
 		}
 
+		ObjPtr<GameObject> rootClone = slots[plan.nodes.front().goSlot].Cast<GameObject>();
 		if (rootClone.IsValid())
 		{
 			auto origRootParent = original->GetTransform()->GetParent();
 			if (origRootParent.IsValid() && !origRootParent->IsDestroyed())
-			{
-				if (!FindMappedTransform(ctx, origRootParent).IsValid())
-					rootClone->GetTransform()->SetParent(origRootParent, false);
-			}
+				rootClone->GetTransform()->SetParent(origRootParent, false);
 		}
 
 		return rootClone;
@@ -465,8 +747,15 @@ MMMEngine::ObjPtr<MMMEngine::GameObject> MMMEngine::Object::Instantiate(const Ob
 	if (!original.IsValid() || original->IsDestroyed())
 		return ObjPtr<GameObject>();
 
-	CloneContext ctx;
-	return InstantiateGameObjectInternal(original, ctx);
+	CloneResult result;
+	return InstantiateGameObjectInternal(original, result);
+}
+
+void MMMEngine::Object::ClearInstantiateCache()
+{
+	auto& cache = GetClonePlanCache();
+	cache.plans.clear();
+	cache.purgeThreshold = 64;
 }
 
 MMMEngine::ObjPtr<MMMEngine::Component> MMMEngine::Object::Instantiate(const ObjPtr<Component>& original)
@@ -478,14 +767,14 @@ MMMEngine::ObjPtr<MMMEngine::Component> MMMEngine::Object::Instantiate(const Obj
 	if (!owner.IsValid() || owner->IsDestroyed())
 		return ObjPtr<Component>();
 
-	CloneContext ctx;
-	ObjPtr<GameObject> clonedRoot = InstantiateGameObjectInternal(owner, ctx);
+	CloneResult result;
+	ObjPtr<GameObject> clonedRoot = InstantiateGameObjectInternal(owner, result);
 	if (!clonedRoot.IsValid())
 		return ObjPtr<Component>();
 
-	auto it = ctx.objectMap.find(original.operator->());
-	if (it != ctx.objectMap.end())
-		return it->second.Cast<Component>();
+	auto it = result.plan->slotOf.find(original.operator->());
+	if (it != result.plan->slotOf.end() && result.slots[it->second].IsValid())
+		return result.slots[it->second].Cast<Component>();
 
 	rttr::type originalType = rttr::type::get(*original);
 	for (auto& comp : clonedRoot->GetAllComponents())
@@ -68,6 +68,9 @@ namespace MMMEngine
         template<typename T>
         static ObjPtr<T> Instantiate(const ObjPtr<T>& original);
 
+        // Instantiate 가 원본별로 캐시해둔 클론 플랜 비우기 (스크립트 DLL 언로드 등 rttr 타입이 사라질 때)
+        static void ClearInstantiateCache();
+
         static void DontDestroyOnLoad(const ObjPtrBase& objPtr);
 
 		static void Destroy(const ObjPtrBase& objPtr, float delay = 0.0f);
@@ -1,4 +1,6 @@
 #include "ObjectManager.h"
+#include "Profiler.h"
+#include <chrono>
 
 DEFINE_SINGLETON(MMMEngine::ObjectManager)
 
@@ -23,68 +25,121 @@ namespace MMMEngine {
 
 void MMMEngine::ObjectManager::UpdateInternalTimer(float deltaTime)
 {
-    size_t i = 0;
-    while (i < m_delayedDestroy.size())
+    m_timerClock += deltaTime;
+
+    //  Ÿ̸Ӹ Ƿ    Ӵ O(  * log n)
+    while (!m_delayedDestroy.empty() && m_delayedDestroy.top().fireTime <= m_timerClock)
     {
-        const uint32_t id = m_delayedDestroy[i];
-        if (id >= m_objectPtrInfos.size())
-        {
-            m_delayedDestroy[i] = m_delayedDestroy.back();
-            m_delayedDestroy.pop_back();
+        const DestroyTimer timer = m_delayedDestroy.top();
+        m_delayedDestroy.pop();
+
+        if (timer.ptrID >= m_objectPtrInfos.size())
             continue;
-        }
 
-        auto& info = m_objectPtrInfos[id];
-        if (!info.raw || info.raw->IsDestroyed() || info.destroyRemainTime < 0.0f)
-        {
-            info.destroyScheduled = false;
-            info.destroyRemainTime = -1.0f;
+        auto& info = m_objectPtrInfos[timer.ptrID];
 
-            m_delayedDestroy[i] = m_delayedDestroy.back();
-            m_delayedDestroy.pop_back();
+        // ̹ / ̰ų մ ȿ  ׸
+        if (!info.raw
+            || info.ptrGenerations != timer.ptrGen
+            || info.destroyFireTime != timer.fireTime)
             continue;
-        }
-        info.destroyRemainTime -= deltaTime;
 
-        if (info.destroyRemainTime <= 0.0f)
-        {
-            m_pendingDestroy.push_back(id);
+        info.destroyFireTime = -1.0;
+        if (info.raw->IsDestroyed())
+            continue;
 
-            // ı  destroyed · ȯ
-            info.raw->MarkDestroy();
+        m_pendingDestroy.push_back(timer.ptrID);
 
-            // delayed 
-            info.destroyScheduled = false;
-            info.destroyRemainTime = -1.0f;
+        // ı  destroyed · ȯ
+        info.raw->MarkDestroy();
+    }
+}
 
-            m_delayedDestroy[i] = m_delayedDestroy.back();
-            m_delayedDestroy.pop_back();
+void MMMEngine::ObjectManager::RetirePendingDestroy()
+{
+    //  raw   ObjPtrδ ٷ  Ұϰ ,   꿡   
+    // ID   ڿ ȯϹǷ      
+    for (uint32_t ptrID : m_pendingDestroy)
+    {
+        if (ptrID >= m_objectPtrInfos.size())
+            continue;
+
+        auto& info = m_objectPtrInfos[ptrID];
+        if (!info.raw)
             continue;
-        }
 
-        ++i;
+        m_retiredObjects.push_back({ info.raw, ptrID });
+        info.raw = nullptr;
     }
+
+    m_pendingDestroy.clear();
+}
+
+void MMMEngine::ObjectManager::DeleteRetired(Object* _raw, uint32_t _ptrID)
+{
+    delete _raw;
+
+    auto& info = m_objectPtrInfos[_ptrID];
+    MemoryTracker::Get().OnFree(info.memTag, info.memSize);
+    info.destroyFireTime = -1.0;
+    m_freePtrIDs.push(_ptrID);
 }
 
 void MMMEngine::ObjectManager::ProcessPendingDestroy()
 {
+    MMM_PROFILE_FUNCTION();
+    RetirePendingDestroy();
+
+    if (m_retiredObjects.empty())
+        return;
+
     DestroyScope scope;
 
-    for (uint32_t ptrID : m_pendingDestroy)
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    const auto timeBudget = std::chrono::microseconds(m_destroyBudgetMicroseconds);
+    uint32_t deletedCount = 0;
+
+    while (!m_retiredObjects.empty())
     {
-        if (ptrID >= m_objectPtrInfos.size())
-            continue;
+        // ּ Ѱ  ⿭ ׻ پ 
+        if (deletedCount > 0)
+        {
+            if (m_destroyBudgetCount > 0 && deletedCount >= m_destroyBudgetCount)
+                break;
+
+            // ð б  ̷ 16 Ȯ
+            if (m_destroyBudgetMicroseconds > 0
+                && (deletedCount % 16) == 0
+                && Clock::now() - start >= timeBudget)
+                break;
+        }
 
-        Object* obj = m_objectPtrInfos[ptrID].raw;
-        if (!obj)
-            continue;
+        const RetiredObject retired = m_retiredObjects.front();
+        m_retiredObjects.pop_front();
+        DeleteRetired(retired.raw, retired.ptrID);
+        ++deletedCount;
+    }
+}
+
+void MMMEngine::ObjectManager::FlushPendingDestroy()
+{
+    MMM_PROFILE_FUNCTION();
+    RetirePendingDestroy();
 
-        delete obj;
-        m_objectPtrInfos[ptrID].raw = nullptr;
-        m_freePtrIDs.push(ptrID);
+    DestroyScope scope;
+    while (!m_retiredObjects.empty())
+    {
+        const RetiredObject retired = m_retiredObjects.front();
+        m_retiredObjects.pop_front();
+        DeleteRetired(retired.raw, retired.ptrID);
     }
+}
 
-    m_pendingDestroy.clear();
+void MMMEngine::ObjectManager::SetDestroyBudget(uint32_t _maxObjects, uint32_t _maxMicroseconds)
+{
+    m_destroyBudgetCount = _maxObjects;
+    m_destroyBudgetMicroseconds = _maxMicroseconds;
 }
 
 bool MMMEngine::ObjectManager::IsCreatingObject()
@@ -127,23 +182,13 @@ void MMMEngine::ObjectManager::Destroy(const ObjPtrBase& objPtr, float delayTime
         return;
     }
 
-    //  ı  (Ǵ մ)
-    if (info.destroyRemainTime < 0.0f)
-    {
-        info.destroyRemainTime = delayTime;
+    //  ı  (Ǵ մ,   ð ݿ)
+    const double fireTime = m_timerClock + delayTime;
+    if (info.destroyFireTime >= 0.0 && info.destroyFireTime <= fireTime)
+        return;
 
-        if (!info.destroyScheduled)
-        {
-            info.destroyScheduled = true;
-            m_delayedDestroy.push_back(id);
-        }
-    }
-    else
-    {
-        //   ð ݿ
-        if (delayTime < info.destroyRemainTime)
-            info.destroyRemainTime = delayTime;
-    }
+    info.destroyFireTime = fireTime;
+    m_delayedDestroy.push({ fireTime, id, info.ptrGenerations });
 }
 
 void MMMEngine::ObjectManager::StartUp()
@@ -158,7 +203,17 @@ void MMMEngine::ObjectManager::ShutDown()
 
     // ı  ȿȭ
     m_pendingDestroy.clear();
-    m_delayedDestroy.clear();
+    m_delayedDestroy = {};
+    m_timerClock = 0.0;
+
+    // Կ ̹    Ʈ
+    for (const RetiredObject& retired : m_retiredObjects)
+    {
+        delete retired.raw;
+        const auto& info = m_objectPtrInfos[retired.ptrID];
+        MemoryTracker::Get().OnFree(info.memTag, info.memSize);
+    }
+    m_retiredObjects.clear();
 
     for (ObjectPtrInfo& info : m_objectPtrInfos)
     {
@@ -166,14 +221,15 @@ void MMMEngine::ObjectManager::ShutDown()
         {
             delete info.raw;
             info.raw = nullptr;
+            MemoryTracker::Get().OnFree(info.memTag, info.memSize);
             info.ptrGenerations = 0;
-            info.destroyRemainTime = -1.0f;
-            info.destroyScheduled = false;
+            info.destroyFireTime = -1.0;
         }
     }
 
     m_objectPtrInfos.clear();
     m_objectPtrInfos.shrink_to_fit();
+    Object::ClearInstantiateCache();
 
     // free id  
     while (!m_freePtrIDs.empty())
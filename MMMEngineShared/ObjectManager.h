@@ -2,8 +2,11 @@
 #include "Export.h"
 #include "ExportSingleton.hpp"
 #include "Object.h"
+#include "MemoryTracker.h"
 #include <vector>
 #include <queue>
+#include <deque>
+#include <functional>
 #include <mutex>
 
 namespace MMMEngine
@@ -17,15 +20,44 @@ namespace MMMEngine
             Object* raw = nullptr;
             uint32_t ptrGenerations = 0;
 
-            float destroyRemainTime = -1.0f;
-            bool destroyScheduled = false;  
+            double destroyFireTime = -1.0;   // 지연 파괴 시각 (내부 타이머 기준, 음수면 예약 없음)
+
+            MemoryTag memTag = INVALID_MEMORY_TAG;  // "Object/<타입>" 태그
+            uint32_t memSize = 0;
         };
 
         std::vector<ObjectPtrInfo> m_objectPtrInfos;
         std::queue<uint32_t> m_freePtrIDs;
 
-        std::vector<uint32_t> m_delayedDestroy;   //파괴 예약 ID
-        std::vector<uint32_t> m_pendingDestroy;   //완전 파괴 ID
+        // 지연 파괴 타이머 (fireTime 기준 min-heap)
+        // 앞당기기는 새 항목을 넣고, 오래된 항목은 꺼낼 때 fireTime/세대 비교로 버림
+        struct DestroyTimer
+        {
+            double fireTime;
+            uint32_t ptrID;
+            uint32_t ptrGen;
+
+            bool operator>(const DestroyTimer& _other) const { return fireTime > _other.fireTime; }
+        };
+        std::priority_queue<DestroyTimer, std::vector<DestroyTimer>, std::greater<DestroyTimer>> m_delayedDestroy;
+        double m_timerClock = 0.0;
+
+        // 삭제 대기 (슬롯의 raw는 이미 끊겨서 ObjPtr로 접근 불가, ID는 삭제 후에 반환)
+        struct RetiredObject
+        {
+            Object* raw;
+            uint32_t ptrID;
+        };
+
+        std::vector<uint32_t> m_pendingDestroy;   //이번 프레임에 파괴된 ID
+        std::deque<RetiredObject> m_retiredObjects;
+
+        // 프레임당 삭제 예산 (0이면 무제한)
+        uint32_t m_destroyBudgetCount = 0;
+        uint32_t m_destroyBudgetMicroseconds = 2000;
+
+        void RetirePendingDestroy();
+        void DeleteRetired(Object* _raw, uint32_t _ptrID);
 
     public:
         static bool IsCreatingObject();
@@ -145,7 +177,7 @@ namespace MMMEngine
             {
                 // 새 슬롯 할당
                 ptrID = static_cast<uint32_t>(m_objectPtrInfos.size());
-                m_objectPtrInfos.push_back({ newObj,0,-1.0f,false });
+                m_objectPtrInfos.push_back({ newObj,0,-1.0 });
                 ptrGen = 0;
             }
             else
@@ -160,6 +192,12 @@ namespace MMMEngine
             baseObj->m_ptrID = ptrID;
             baseObj->m_ptrGen = ptrGen;
 
+            // 타입별 첫 생성에만 태그 등록 (객체 자체 크기만 집계, 멤버가 따로 잡는 힙은 제외)
+            static const MemoryTag s_memTag = MemoryTracker::Get().RegisterTag("Object/" + rttr::type::get<T>().get_name().to_string());
+            m_objectPtrInfos[ptrID].memTag = s_memTag;
+            m_objectPtrInfos[ptrID].memSize = static_cast<uint32_t>(sizeof(T));
+            MemoryTracker::Get().OnAlloc(s_memTag, sizeof(T));
+
             newObj->Construct();
             return ObjPtr<T>(newObj, ptrID, ptrGen);
         }
@@ -170,7 +208,22 @@ namespace MMMEngine
         void ShutDown();
 
         void UpdateInternalTimer(float deltaTime);
+        // 파괴된 오브젝트를 예산 안에서만 삭제 (남은 건 다음 프레임으로 넘어감)
         void ProcessPendingDestroy();
+        // 예산 무시하고 대기 중인 삭제를 전부 처리 (벤치마크/종료 직전 등)
+        void FlushPendingDestroy();
+
+        // _maxObjects : 프레임당 최대 삭제 수, _maxMicroseconds : 프레임당 최대 삭제 시간 (각각 0이면 무제한)
+        void SetDestroyBudget(uint32_t _maxObjects, uint32_t _maxMicroseconds);
+        uint32_t GetDestroyBudgetCount() const { return m_destroyBudgetCount; }
+        uint32_t GetDestroyBudgetMicroseconds() const { return m_destroyBudgetMicroseconds; }
+
+        // 살아있는 오브젝트 수 (파괴 예약됐지만 아직 삭제되지 않은 오브젝트 포함)
+        size_t GetLiveObjectCount() const { return m_objectPtrInfos.size() - m_freePtrIDs.size(); }
+        // 파괴됐지만 아직 삭제되지 않은 오브젝트 수
+        size_t GetPendingDestroyCount() const { return m_pendingDestroy.size() + m_retiredObjects.size(); }
+        // 지연 파괴 타이머 수 (앞당기기로 무효가 된 항목 포함)
+        size_t GetDelayedDestroyCount() const { return m_delayedDestroy.size(); }
 
         ObjectManager() = default;
         ~ObjectManager();
@@ -0,0 +1,228 @@
+﻿#include "ObjectPool.h"
+#include "Transform.h"
+#include "BehaviourManager.h"
+#include <algorithm>
+
+MMMEngine::ObjectPool::ObjectPool(const ObjPtr<GameObject>& _prefab, size_t _prewarmCount, size_t _maxSize)
+	: m_prefab(_prefab), m_maxSize(_maxSize)
+{
+	if (!IsAlive(m_prefab))
+		return;
+
+	std::vector<ObjPtr<Transform>> nodes;
+	CollectNodes(m_prefab->GetTransform(), nodes);
+
+	m_poses.reserve(nodes.size());
+	for (auto& node : nodes)
+	{
+		m_poses.push_back({
+			node->GetLocalPosition(),
+			node->GetLocalRotation(),
+			node->GetLocalScale(),
+			node->GetGameObject()->IsActiveSelf() });
+	}
+
+	Prewarm(_prewarmCount);
+}
+
+MMMEngine::ObjectPool::~ObjectPool()
+{
+	Clear();
+}
+
+void MMMEngine::ObjectPool::CollectNodes(const ObjPtr<Transform>& _root, std::vector<ObjPtr<Transform>>& _out)
+{
+	if (!_root.IsValid())
+		return;
+
+	_out.push_back(_root);
+	const size_t childCount = _root->GetChildCount();
+	for (size_t i = 0; i < childCount; ++i)
+		CollectNodes(_root->GetChild(i), _out);
+}
+
+MMMEngine::ObjPtr<MMMEngine::GameObject> MMMEngine::ObjectPool::CreateInstance()
+{
+	if (!IsAlive(m_prefab))
+		return nullptr;
+
+	ObjPtr<GameObject> clone = Object::Instantiate(m_prefab);
+	if (!clone.IsValid())
+		return nullptr;
+
+	// 같은 프레임 안에서 끄므로 Awake/OnEnable 은 실제로 꺼내서 켤 때 처음 호출됨
+	clone->SetActive(false);
+	clone->GetTransform()->SetParent(nullptr, false);
+	++m_stats.instantiateCount;
+
+	Instance instance;
+	CollectNodes(clone->GetTransform(), instance.nodes);
+	m_instances.emplace(clone, std::move(instance));
+	return clone;
+}
+
+void MMMEngine::ObjectPool::Prewarm(size_t _count)
+{
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (m_maxSize > 0 && m_available.size() >= m_maxSize)
+			break;
+
+		ObjPtr<GameObject> clone = CreateInstance();
+		if (!clone.IsValid())
+			break;
+
+		m_instances[clone].pooled = true;
+		m_available.push_back(clone);
+	}
+}
+
+void MMMEngine::ObjectPool::ResetInstance(Instance& _instance)
+{
+	// 원본과 계층 구조가 달라졌으면 (꺼낸 뒤 자식을 붙이는 등) 앞쪽 노드만 되돌림
+	const size_t count = std::min(_instance.nodes.size(), m_poses.size());
+	for (size_t i = 0; i < count; ++i)
+	{
+		auto& node = _instance.nodes[i];
+		if (!node.IsValid())
+			continue;
+
+		const NodePose& pose = m_poses[i];
+		node->SetLocalPosition(pose.localPosition);
+		node->SetLocalRotation(pose.localRotation);
+		node->SetLocalScale(pose.localScale);
+
+		// 루트 활성화는 Get 에서 위치를 잡은 뒤에 함
+		if (i > 0)
+			node->GetGameObject()->SetActive(pose.active);
+	}
+}
+
+void MMMEngine::ObjectPool::PurgeDead()
+{
+	for (auto it = m_instances.begin(); it != m_instances.end();)
+	{
+		if (!IsAlive(it->first))
+			it = m_instances.erase(it);
+		else
+			++it;
+	}
+
+	m_available.erase(
+		std::remove_if(m_available.begin(), m_available.end(),
+			[](const ObjPtr<GameObject>& _go) { return !IsAlive(_go); }),
+		m_available.end());
+
+	m_purgeThreshold = std::max<size_t>(64, m_instances.size() * 2);
+}
+
+MMMEngine::ObjPtr<MMMEngine::GameObject> MMMEngine::ObjectPool::Acquire()
+{
+	const uint32_t disablePass = BehaviourManager::Get().GetDisablePassCount();
+
+	while (!m_available.empty())
+	{
+		ObjPtr<GameObject> go = m_available.front();
+
+		// 씬 전환이나 직접 Destroy 로 죽은 인스턴스는 버림
+		auto it = m_instances.find(go);
+		if (it == m_instances.end() || !IsAlive(go))
+		{
+			if (it != m_instances.end())
+				m_instances.erase(it);
+			m_available.pop_front();
+			continue;
+		}
+
+		// 오래 반환된 순이므로 맨 앞이 아직 OnDisable 전이면 나머지도 전부 OnDisable 전
+		Instance& instance = it->second;
+		if (instance.waitDisable && instance.releasePass == disablePass)
+			break;
+
+		m_available.pop_front();
+		instance.pooled = false;
+		ResetInstance(instance);
+		++m_stats.hitCount;
+		return go;
+	}
+
+	++m_stats.missCount;
+	if (m_instances.size() >= m_purgeThreshold)
+		PurgeDead();
+
+	return CreateInstance();
+}
+
+MMMEngine::ObjPtr<MMMEngine::GameObject> MMMEngine::ObjectPool::Get()
+{
+	ObjPtr<GameObject> go = Acquire();
+	if (!go.IsValid())
+		return nullptr;
+
+	go->SetActive(true);
+	return go;
+}
+
+MMMEngine::ObjPtr<MMMEngine::GameObject> MMMEngine::ObjectPool::Get(const DirectX::SimpleMath::Vector3& _position,
+	const DirectX::SimpleMath::Quaternion& _rotation,
+	const ObjPtr<Transform>& _parent)
+{
+	ObjPtr<GameObject> go = Acquire();
+	if (!go.IsValid())
+		return nullptr;
+
+	auto transform = go->GetTransform();
+	if (_parent.IsValid())
+		transform->SetParent(_parent, false);
+	transform->SetWorldPosition(_position);
+	transform->SetWorldRotation(_rotation);
+
+	go->SetActive(true);
+	return go;
+}
+
+bool MMMEngine::ObjectPool::Release(const ObjPtr<GameObject>& _instance)
+{
+	auto it = m_instances.find(_instance);
+	if (it == m_instances.end() || it->second.pooled)
+		return false;
+
+	if (!IsAlive(_instance))
+	{
+		m_instances.erase(it);
+		return false;
+	}
+
+	++m_stats.releaseCount;
+
+	if (m_maxSize > 0 && m_available.size() >= m_maxSize)
+	{
+		++m_stats.overflowCount;
+		m_instances.erase(it);
+		Object::Destroy(_instance);
+		return true;
+	}
+
+	_instance->SetActive(false);
+	_instance->GetTransform()->SetParent(nullptr, false);
+
+	Instance& instance = it->second;
+	instance.pooled = true;
+	instance.waitDisable = true;
+	instance.releasePass = BehaviourManager::Get().GetDisablePassCount();
+	m_available.push_back(_instance);
+	return true;
+}
+
+void MMMEngine::ObjectPool::Clear()
+{
+	for (auto& go : m_available)
+	{
+		if (IsAlive(go))
+			Object::Destroy(go);
+	}
+
+	m_available.clear();
+	m_instances.clear();
+	m_purgeThreshold = 64;
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+#include "Export.h"
+#include "GameObject.h"
+#include "SimpleMath.h"
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace MMMEngine
+{
+	class Transform;
+
+	struct ObjectPoolStats
+	{
+		uint32_t hitCount = 0;			// 풀에 있던 인스턴스로 응답한 횟수
+		uint32_t missCount = 0;			// 꺼낼 인스턴스가 없어서 새로 Instantiate 한 횟수
+		uint32_t releaseCount = 0;
+		uint32_t overflowCount = 0;		// 최대 크기를 넘어서 반환 대신 파괴한 횟수
+		uint32_t instantiateCount = 0;	// 프리웜 포함 Instantiate 총 횟수
+	};
+
+	// 원본 GameObject 계층(프리팹)을 미리 복제해두고 재사용하는 풀
+	// Get : 계층 전체의 로컬 트랜스폼/활성 상태를 원본 기준으로 되돌리고 루트를 활성화해서 돌려줌
+	// Release : 루트를 비활성화하고 부모에서 떼어 풀에 넣음 (파괴하지 않음)
+	// OnEnable/OnDisable 은 SetActive 를 통해 BehaviourManager 가 평소처럼 호출하고,
+	// 반환된 인스턴스는 DisableBehaviours 로 OnDisable 을 받은 뒤에만 다시 꺼냄
+	class MMMENGINE_API ObjectPool
+	{
+	private:
+		// 원본 계층 노드 하나의 초기 상태 (전위 순회 순서)
+		struct NodePose
+		{
+			DirectX::SimpleMath::Vector3 localPosition;
+			DirectX::SimpleMath::Quaternion localRotation;
+			DirectX::SimpleMath::Vector3 localScale;
+			bool active;
+		};
+
+		struct Instance
+		{
+			std::vector<ObjPtr<Transform>> nodes;	// m_poses 와 같은 순서
+			uint32_t releasePass = 0;				// 반환 시점의 BehaviourManager::GetDisablePassCount
+			bool waitDisable = false;				// 활성화된 적이 있어서 OnDisable 을 기다려야 함
+			bool pooled = false;
+		};
+
+		ObjPtr<GameObject> m_prefab;
+		std::vector<NodePose> m_poses;
+
+		std::unordered_map<ObjPtr<GameObject>, Instance> m_instances;
+		std::deque<ObjPtr<GameObject>> m_available;	// 오래 반환된 순
+		size_t m_maxSize = 0;
+		size_t m_purgeThreshold = 64;
+
+		ObjectPoolStats m_stats;
+
+		static void CollectNodes(const ObjPtr<Transform>& _root, std::vector<ObjPtr<Transform>>& _out);
+		static bool IsAlive(const ObjPtr<GameObject>& _go) { return _go.IsValid() && !_go->IsDestroyed(); }
+
+		ObjPtr<GameObject> CreateInstance();
+		ObjPtr<GameObject> Acquire();
+		void ResetInstance(Instance& _instance);
+		void PurgeDead();
+
+	public:
+		// _maxSize : 풀에 보관할 최대 개수 (0이면 무제한, 넘치면 Release 가 파괴함)
+		ObjectPool(const ObjPtr<GameObject>& _prefab, size_t _prewarmCount = 0, size_t _maxSize = 0);
+		~ObjectPool();
+
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+
+		void Prewarm(size_t _count);
+
+		// 원본의 로컬 트랜스폼 그대로 꺼냄 (루트는 부모 없음)
+		ObjPtr<GameObject> Get();
+		ObjPtr<GameObject> Get(const DirectX::SimpleMath::Vector3& _position,
+			const DirectX::SimpleMath::Quaternion& _rotation,
+			const ObjPtr<Transform>& _parent = nullptr);
+
+		// 이 풀에서 꺼낸 인스턴스만 받음 (아니면 false)
+		bool Release(const ObjPtr<GameObject>& _instance);
+
+		// 풀에 있는 인스턴스를 전부 파괴 (꺼내간 인스턴스는 그대로 두고 추적만 끊음)
+		void Clear();
+
+		const ObjPtr<GameObject>& GetPrefab() const { return m_prefab; }
+		size_t GetAvailableCount() const { return m_available.size(); }
+		size_t GetInUseCount() const { return m_instances.size() - m_available.size(); }
+		const ObjectPoolStats& GetStats() const { return m_stats; }
+		void ResetStats() { m_stats = {}; }
+	};
+}
@@ -16,6 +16,10 @@ namespace MMMEngine {
 		Microsoft::WRL::ComPtr<ID3D11PixelShader> m_pPShader;
 		Microsoft::WRL::ComPtr<ID3DBlob> m_pBlob;
 
+		// ShaderInfo 타입 핸들 캐시 (경로는 최초 한번만 해시)
+		int m_typeHandle = -1;
+		uint32_t m_typeHandleGeneration = UINT32_MAX;
+
 		bool LoadFromFilePath(const std::wstring& filePath) override;
 	};
 }
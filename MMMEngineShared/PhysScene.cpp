@@ -5,6 +5,9 @@
 #include "CollisionMatrix.h"
 #include "GameObject.h"
 #include "PhysX.h"
+#include <physx/extensions/PxBroadPhaseExt.h>
+#include <algorithm>
+#include <chrono>
 
 bool MMMEngine::PhysScene::Create(const PhysSceneDesc& desc)
 {
@@ -41,21 +44,52 @@ bool MMMEngine::PhysScene::CreateScene()
 	pxDesc.filterShader = CustomFilterShader;
 	pxDesc.simulationEventCallback = &m_callback;
 	pxDesc.flags |= physx::PxSceneFlag::eENABLE_CCD;
+	//움직인 actor 목록만 받아서 Pull하기 위함
+	pxDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 	pxDesc.solverType = physx::PxSolverType::eTGS;
+	pxDesc.broadPhaseType = m_desc.broadPhaseType;
+	pxDesc.broadPhaseCallback = &m_broadPhaseCallback;
+	//결정론 모드 : 같은 API 호출 순서면 다른 island 유무/actor 수와 상관없이 같은 결과 (생성 시점에만 설정 가능)
+	if (m_desc.enableEnhancedDeterminism)
+		pxDesc.flags |= physx::PxSceneFlag::eENABLE_ENHANCED_DETERMINISM;
 
 	m_scene = PhysicX::Get().GetPhysics().createScene(pxDesc);
 	if (m_scene == nullptr) return false;
 
+	if (m_desc.broadPhaseType == physx::PxBroadPhaseType::eMBP)
+		AddBroadPhaseRegions();
+
 	return true;
 }
 
+void MMMEngine::PhysScene::AddBroadPhaseRegions()
+{
+	if (!m_scene) return;
+	if (!m_desc.worldBounds.isValid()) return;
+
+	//MBP 영역은 최대 256개
+	const physx::PxU32 subdiv = std::clamp<physx::PxU32>(m_desc.broadPhaseSubdivisions, 1u, 16u);
+
+	std::vector<physx::PxBounds3> bounds(subdiv * subdiv);
+	const physx::PxU32 count = physx::PxBroadPhaseExt::createRegionsFromWorldBounds(bounds.data(), m_desc.worldBounds, subdiv, 1);
+
+	for (physx::PxU32 i = 0; i < count; ++i)
+	{
+		physx::PxBroadPhaseRegion region;
+		region.mBounds = bounds[i];
+		region.mUserData = nullptr;
+		m_scene->addBroadPhaseRegion(region, false);
+	}
+}
+
 void MMMEngine::PhysScene::Destroy()
 {
 	if (m_scene)
 	{
-		std::vector<RigidBodyComponent*> rigidsCopy;
-		rigidsCopy.reserve(m_rigids.size());
-		for (auto* rb : m_rigids) rigidsCopy.push_back(rb);
+		//계산중인 스텝이 있으면 끝날때까지 대기 후 정리
+		EndStep(true);
+
+		std::vector<RigidBodyComponent*> rigidsCopy = m_rigids;
 
 		for (auto* rb : rigidsCopy)
 			UnregisterRigid(rb);
@@ -64,6 +98,9 @@ void MMMEngine::PhysScene::Destroy()
 		m_ownerByCollider.clear();
 		m_collidersByRigid.clear();
 		m_rigids.clear();
+		m_rigidIndex.clear();
+		m_interpRigids.clear();
+		m_pulledPoses.clear();
 
 		m_scene->release();
 		m_scene = nullptr;
@@ -80,68 +117,279 @@ void MMMEngine::PhysScene::Destroy()
 }
 
 void MMMEngine::PhysScene::Step(float dt)
+{
+	if (m_stepProfiling)
+	{
+		ProfiledStep(dt);
+		return;
+	}
+
+	BeginStep(dt);
+	EndStep(true);
+}
+
+void MMMEngine::PhysScene::ProfiledStep(float dt)
 {
 	if (!m_scene) return;
 	if (dt <= 0.0f) return;
+	if (m_isSimulating) return;
 
-	m_scene->simulate(dt);
+	using Clock = std::chrono::steady_clock;
+	auto ToMs = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+	//simulate와 같은 결과, 단계 사이에서 대기해서 시간만 나눠 잼
+	const auto t0 = Clock::now();
+	m_scene->collide(dt);
+	m_scene->fetchCollision(true);
+	const auto t1 = Clock::now();
+	m_scene->advance();
 	m_scene->fetchResults(true);
+	const auto t2 = Clock::now();
+
+	m_stepStats.collisionMs = ToMs(t1 - t0);
+	m_stepStats.solverMs = ToMs(t2 - t1);
+	m_stepStats.totalMs = ToMs(t2 - t0);
+
+	physx::PxSimulationStatistics stats;
+	m_scene->getSimulationStatistics(stats);
+	m_stepStats.activeDynamics = stats.nbActiveDynamicBodies;
+	m_stepStats.broadPhaseAdds = stats.getNbBroadPhaseAdds();
+	m_stepStats.broadPhaseRemoves = stats.getNbBroadPhaseRemoves();
+	m_stepStats.contactPairs = stats.nbDiscreteContactPairsTotal;
+	m_stepStats.outOfBounds = m_broadPhaseCallback.outOfBoundsCount;
+}
+
+void MMMEngine::PhysScene::BeginStep(float dt)
+{
+	if (!m_scene) return;
+	if (dt <= 0.0f) return;
+	if (m_isSimulating) return;
+
+	m_scene->simulate(dt);
+	m_isSimulating = true;
+}
+
+bool MMMEngine::PhysScene::EndStep(bool block)
+{
+	if (!m_scene || !m_isSimulating) return true;
+
+	if (!m_scene->fetchResults(block))
+		return false;
+
+	m_isSimulating = false;
+	return true;
 }
 
 void MMMEngine::PhysScene::PullRigidsFromPhysics()
 {
-	// 여기서는 "유효한 rb + 유효한 actor"만 Pull
-	for (auto* rb : m_rigids)
+	if (!m_scene) return;
+
+	//이번 스텝에서 움직인 actor만 받아옴 (eENABLE_ACTIVE_ACTORS) //잠든 rigid, static은 방문하지 않음
+	physx::PxU32 activeCount = 0;
+	physx::PxActor** activeActors = m_scene->getActiveActors(activeCount);
+
+	//1) pose를 연속 배열로 먼저 읽어둠
+	m_pulledPoses.clear();
+	m_pulledPoses.reserve(activeCount);
+	for (physx::PxU32 i = 0; i < activeCount; ++i)
 	{
+		auto* t_dynamic = activeActors[i]->is<physx::PxRigidDynamic>();
+		if (!t_dynamic) continue;
+
+		auto* rb = static_cast<RigidBodyComponent*>(t_dynamic->userData);
 		if (!rb) continue;
 
-		// ObjPtr라면 IsValid()가 안전장치 역할. (댕글링이면 이조차 위험할 수 있는데,
-		// 최종적으로는 rb 제거가 Notify/Unregister를 통해 들어오게 만드는 게 맞다.)
-		if (!rb->GetGameObject().IsValid()) continue;
+		//등록 해제 대기중인 actor의 userData가 남아있을 수 있으니 목록으로 한번 거름
+		if (!HasRigid(rb)) continue;
+
+		m_pulledPoses.push_back({ rb, t_dynamic->getGlobalPose() });
+	}
 
+	//2) Transform에 일괄 반영
+	m_nextInterpRigids.clear();
+	for (const auto& pulled : m_pulledPoses)
+	{
+		auto* rb = pulled.rb;
+		if (!rb->GetGameObject().IsValid()) continue;
 		if (!rb->GetPxActor()) continue;
 
-		rb->PullFromPhysics();
+		rb->PullFromPose(pulled.pose);
+
+		if (rb->UsesInterpolation())
+			m_nextInterpRigids.push_back(rb);
 	}
+	std::sort(m_nextInterpRigids.begin(), m_nextInterpRigids.end());
+
+	//3) 직전까지 보간중이었는데 이번 스텝에 움직이지 않은(잠든) rigid는 현재 포즈로 고정
+	//   안 그러면 prev/curr 차이가 남은채로 계속 보간됨
+	auto itNext = m_nextInterpRigids.begin();
+	for (auto* rb : m_interpRigids)
+	{
+		while (itNext != m_nextInterpRigids.end() && *itNext < rb) ++itNext;
+		if (itNext != m_nextInterpRigids.end() && *itNext == rb) continue;
+
+		if (!HasRigid(rb)) continue;
+		if (!rb->GetGameObject().IsValid()) continue;
+		rb->SettleInterpolation();
+	}
+
+	m_interpRigids.swap(m_nextInterpRigids);
 }
 
 void MMMEngine::PhysScene::ApplyInterpolation(float alpha)
 {
-	for (auto* rb : m_rigids)
+	if (m_interpRigids.empty()) return;
+
+	alpha = std::clamp(alpha, 0.0f, 1.0f);
+
+	//1) 보간 대상 포즈를 연속 배열로 모음
+	m_interpBatch.clear();
+	m_interpPoses.clear();
+	for (auto* rb : m_interpRigids)
 	{
-		if (!rb) continue;
+		//Pull 이후 해제/파괴됐을 수 있음
+		if (!HasRigid(rb)) continue;
 		if (!rb->GetGameObject().IsValid()) continue;
 		if (!rb->GetPxActor()) continue;
+		if (!rb->UsesInterpolation()) continue;
+
+		InterpPose p;
+		rb->GetInterpolationPoses(p.prevPos, p.prevRot, p.currPos, p.currRot);
+		m_interpBatch.push_back(rb);
+		m_interpPoses.push_back(p);
+	}
+
+	//2) 배열 전체를 DirectXMath(SIMD)로 계산, 결과는 prev 자리에 덮어씀
+	const DirectX::XMVECTOR t = DirectX::XMVectorReplicate(alpha);
+	for (auto& p : m_interpPoses)
+	{
+		DirectX::XMVECTOR pos = DirectX::XMVectorLerpV(DirectX::XMLoadFloat3(&p.prevPos), DirectX::XMLoadFloat3(&p.currPos), t);
+		DirectX::XMVECTOR rot = DirectX::XMQuaternionSlerpV(DirectX::XMLoadFloat4(&p.prevRot), DirectX::XMLoadFloat4(&p.currRot), t);
+		rot = DirectX::XMQuaternionNormalize(rot);
 
-		rb->ApplyInterpolation(alpha);
+		DirectX::XMStoreFloat3(&p.prevPos, pos);
+		DirectX::XMStoreFloat4(&p.prevRot, rot);
+	}
+
+	//3) Transform에 일괄 반영
+	for (size_t i = 0; i < m_interpBatch.size(); ++i)
+	{
+		auto tr = m_interpBatch[i]->GetTransform();
+		if (!tr) continue;
+		tr->SetWorldPosition(m_interpPoses[i].prevPos);
+		tr->SetWorldRotation(m_interpPoses[i].prevRot);
+		//보간으로 쓴 포즈는 물리에 되돌려 보내지 않음
+		m_interpBatch[i]->MarkTransformSynced();
 	}
 }
 
 void MMMEngine::PhysScene::SyncRigidsFromTransforms()
 {
+	m_lastSyncedRigidCount = 0;
+
 	for (auto* rb : m_rigids)
 	{
 		if (!rb) continue;
 		if (!rb->GetGameObject().IsValid()) continue;
 
+		//마지막 Push/Pull 이후 Transform이 안 바뀌었으면 건너뜀
+		//static/잠든 rigid는 대부분 여기서 빠지고, 부모가 움직인 경우는 Transform 버전이 같이 올라가서 잡힘
+		if (!rb->IsTransformChangedSinceSync()) continue;
+
 		auto tr = rb->GetTransform();
 		if (!tr) continue;
 
 		const Vector3 pos = tr->GetWorldPosition();
 		const Quaternion rot = tr->GetWorldRotation();
 		rb->Editor_changeTrans(pos, rot);
+		++m_lastSyncedRigidCount;
 	}
 }
 
 void MMMEngine::PhysScene::DrainEvents()
 {
-	m_frameContacts.clear();
-	m_frameTriggers.clear();
-
 	m_callback.DrainContacts(m_frameContacts);
 	m_callback.DrainTriggers(m_frameTriggers);
 }
 
+void MMMEngine::PhysScene::CaptureRigidStates(std::vector<RigidStateEntry>& out) const
+{
+	out.clear();
+	out.reserve(m_rigids.size());
+
+	//m_rigids 등록 순서 그대로 저장
+	for (auto* rb : m_rigids)
+	{
+		if (!rb || !rb->GetGameObject().IsValid()) continue;
+
+		RigidStateEntry entry;
+		entry.rb = rb;
+		if (rb->CaptureState(entry.state))
+			out.push_back(entry);
+	}
+}
+
+void MMMEngine::PhysScene::RestoreRigidStates(const std::vector<RigidStateEntry>& in)
+{
+	if (!m_scene || m_isSimulating) return;
+
+	for (const auto& entry : in)
+	{
+		//스냅샷 이후 해제된 rigid는 건너뜀
+		if (!HasRigid(entry.rb)) continue;
+		if (!entry.rb->GetGameObject().IsValid()) continue;
+
+		entry.rb->RestoreState(entry.state);
+	}
+
+	//복원한 포즈 기준으로 보간을 다시 시작
+	m_interpRigids.clear();
+}
+
+bool MMMEngine::PhysScene::Raycast(const physx::PxVec3& origin, const physx::PxVec3& unitDir, float maxDistance, physx::PxU32 layerMask, physx::PxRaycastHit& outHit) const
+{
+	//word0 까지 전부 0인 필터는 PhysX가 "필터 없음"으로 취급하므로 여기서 막음
+	if (!m_scene || layerMask == 0) return false;
+
+	const physx::PxQueryFilterData filter(physx::PxFilterData(layerMask, 0, 0, 0),
+		physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC);
+
+	physx::PxRaycastBuffer buffer;
+	if (!m_scene->raycast(origin, unitDir, maxDistance, buffer, physx::PxHitFlag::eDEFAULT, filter) || !buffer.hasBlock)
+		return false;
+
+	outHit = buffer.block;
+	return true;
+}
+
+bool MMMEngine::PhysScene::Sweep(const physx::PxGeometry& geometry, const physx::PxTransform& pose, const physx::PxVec3& unitDir, float maxDistance, physx::PxU32 layerMask, physx::PxSweepHit& outHit) const
+{
+	if (!m_scene || layerMask == 0) return false;
+
+	const physx::PxQueryFilterData filter(physx::PxFilterData(layerMask, 0, 0, 0),
+		physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC);
+
+	physx::PxSweepBuffer buffer;
+	if (!m_scene->sweep(geometry, pose, unitDir, maxDistance, buffer, physx::PxHitFlag::eDEFAULT, filter) || !buffer.hasBlock)
+		return false;
+
+	outHit = buffer.block;
+	return true;
+}
+
+physx::PxU32 MMMEngine::PhysScene::Overlap(const physx::PxGeometry& geometry, const physx::PxTransform& pose, physx::PxU32 layerMask, physx::PxOverlapHit* outHits, physx::PxU32 maxHits) const
+{
+	if (!m_scene || layerMask == 0 || !outHits || maxHits == 0) return 0;
+
+	//블로킹 없이 전부 touch로 받음
+	const physx::PxQueryFilterData filter(physx::PxFilterData(layerMask, 0, 0, 0),
+		physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC | physx::PxQueryFlag::eNO_BLOCK);
+
+	physx::PxOverlapBuffer buffer(outHits, maxHits);
+	m_scene->overlap(geometry, pose, buffer, filter);
+	return buffer.getNbTouches();
+}
+
 void MMMEngine::PhysScene::AddActor(physx::PxActor& actor)
 {
 	if (!m_scene) return;
@@ -154,10 +402,39 @@ void MMMEngine::PhysScene::RemoveActor(physx::PxActor& actor)
 	m_scene->removeActor(actor);
 }
 
+bool MMMEngine::PhysScene::HasRigid(MMMEngine::RigidBodyComponent* rb) const
+{
+	return m_rigidIndex.find(rb) != m_rigidIndex.end();
+}
+
+void MMMEngine::PhysScene::AddRigidEntry(MMMEngine::RigidBodyComponent* rb)
+{
+	m_rigidIndex.emplace(rb, m_rigids.size());
+	m_rigids.push_back(rb);
+}
+
+void MMMEngine::PhysScene::RemoveRigidEntry(MMMEngine::RigidBodyComponent* rb)
+{
+	auto it = m_rigidIndex.find(rb);
+	if (it == m_rigidIndex.end()) return;
+
+	//마지막 원소와 교체 후 제거 //같은 등록/해제 순서면 항상 같은 순서가 나옴
+	const size_t index = it->second;
+	m_rigidIndex.erase(it);
+
+	auto* last = m_rigids.back();
+	m_rigids.pop_back();
+	if (index < m_rigids.size())
+	{
+		m_rigids[index] = last;
+		m_rigidIndex[last] = index;
+	}
+}
+
 void MMMEngine::PhysScene::RegisterRigid(MMMEngine::RigidBodyComponent* rb)
 {
 	if (!m_scene || !rb) return;
-	if (m_rigids.find(rb) != m_rigids.end()) return;
+	if (HasRigid(rb)) return;
 
 	auto go = rb->GetGameObject();
 	if (!go.IsValid()) return;
@@ -178,7 +455,7 @@ void MMMEngine::PhysScene::RegisterRigid(MMMEngine::RigidBodyComponent* rb)
 	if (!actor) return;
 
 	m_scene->addActor(*actor);
-	m_rigids.insert(rb);
+	AddRigidEntry(rb);
 }
 
 void MMMEngine::PhysScene::UnregisterRigid(MMMEngine::RigidBodyComponent* rb)
@@ -186,8 +463,7 @@ void MMMEngine::PhysScene::UnregisterRigid(MMMEngine::RigidBodyComponent* rb)
 	if (!m_scene) return;
 	if (!rb) return;
 
-	auto itR = m_rigids.find(rb);
-	if (itR == m_rigids.end())
+	if (!HasRigid(rb))
 		return; // 등록 안 됨
 
 
@@ -196,8 +472,7 @@ void MMMEngine::PhysScene::UnregisterRigid(MMMEngine::RigidBodyComponent* rb)
 	{
 		if (!m_scene || !rb) return;
 
-		auto itR = m_rigids.find(rb);
-		if (itR == m_rigids.end())
+		if (!HasRigid(rb))
 			return;
 
 		//rb에 달린 콜라이더 목록 확보 (GO invalid여도 이 컨테이너 기반으로 정리 가능)
@@ -219,7 +494,7 @@ void MMMEngine::PhysScene::UnregisterRigid(MMMEngine::RigidBodyComponent* rb)
 			}
 
 			m_collidersByRigid.erase(rb);
-			m_rigids.erase(itR);
+			RemoveRigidEntry(rb);
 			return;
 		}
 
@@ -239,7 +514,7 @@ void MMMEngine::PhysScene::UnregisterRigid(MMMEngine::RigidBodyComponent* rb)
 		}
 
 		m_collidersByRigid.erase(rb);
-		m_rigids.erase(itR);
+		RemoveRigidEntry(rb);
 
 		rb->DestroyActor();
 	}
@@ -272,7 +547,7 @@ void MMMEngine::PhysScene::UnregisterRigid(MMMEngine::RigidBodyComponent* rb)
 
 	// 컨테이너 정리
 	m_collidersByRigid.erase(rb);
-	m_rigids.erase(itR);
+	RemoveRigidEntry(rb);
 	//actor release는 rb가 하도록
 	if (rb->GetGameObject().IsValid())
 	{
@@ -286,7 +561,7 @@ void MMMEngine::PhysScene::AttachCollider(MMMEngine::RigidBodyComponent* rb, MMM
 	if (!rb || !col) return;
 
 	// rb가 등록 안 돼있으면 먼저 등록
-	if (m_rigids.find(rb) == m_rigids.end())
+	if (!HasRigid(rb))
 	{
 		//AttachCollider called for unregistered rigid. RegisterRigid must be called first.
 		assert(false && "actor가 미등록 상태입니다 actor를 먼저 등록하고 collider를 붙여야합니다");
@@ -456,7 +731,9 @@ void MMMEngine::PhysScene::RebuildCollider(MMMEngine::ColliderComponent* col, co
 	//    - 추천: ColliderComponent가 자신의 old shape를 release하고 새로 만든 포인터로 교체.
 	//      (PhysScene는 detach/attach만 책임)
 	auto& physics = PhysicX::Get().GetPhysics();
-	physx::PxMaterial* mat = PhysicX::Get().GetDefaultMaterial(); // 너 엔진 방식에 맞게
+	//콜라이더의 공유 머티리얼 유지 (없으면 기본 머티리얼)
+	col->EnsureMaterial();
+	physx::PxMaterial* mat = col->GetPxMaterial() ? col->GetPxMaterial() : PhysicX::Get().GetDefaultMaterial();
 
 	// attach 상태면 actor에서 먼저 떼고 교체 후 다시 붙이는 게 안전
 	if (rb && rb->GetPxActor() && col->GetPxShape())
@@ -520,7 +797,7 @@ void MMMEngine::PhysScene::ChangeRigidType(MMMEngine::RigidBodyComponent* rb, co
 	if (!m_scene || !rb) return;
 	if (!rb->HasPendingTypeChange()) return;
 
-	const bool registered = (m_rigids.find(rb) != m_rigids.end());
+	const bool registered = (HasRigid(rb));
 
 	//기존 콜라이더 목록 확보 (포인터 복사만)
 	std::vector<ColliderComponent*> cols;
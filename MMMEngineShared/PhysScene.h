@@ -19,6 +19,14 @@ struct PhysSceneDesc
 	bool enableCCD = false;
 	//pvd 현 프로젝트에서는 안씀
 	bool enablePVD = false;
+	//리플레이/네트워크용 결정론 모드 (PxSceneFlag::eENABLE_ENHANCED_DETERMINISM)
+	bool enableEnhancedDeterminism = false;
+
+	//브로드페이즈 //넓은 맵은 MBP + 월드 범위 지정 권장
+	//MBP는 worldBounds를 XZ 평면에서 subdivisions x subdivisions 영역으로 나눠 등록 (영역 밖 shape는 충돌하지 않음)
+	physx::PxBroadPhaseType::Enum broadPhaseType = physx::PxBroadPhaseType::ePABP;
+	physx::PxBounds3 worldBounds = physx::PxBounds3(physx::PxVec3(-1000.f), physx::PxVec3(1000.f));
+	uint32_t broadPhaseSubdivisions = 8;
 
 	//충돌 필터 설정
 	physx::PxSimulationFilterShader userFilterShader = nullptr;
@@ -28,9 +36,28 @@ struct PhysSceneDesc
 
 namespace MMMEngine
 {
+	//스텝 프로파일링 결과 (SetStepProfiling(true)인 동기 스텝에서만 갱신)
+	struct PhysStepStats
+	{
+		double collisionMs = 0.0;	// collide ~ fetchCollision (브로드페이즈 + 내로우페이즈)
+		double solverMs = 0.0;		// advance ~ fetchResults (솔버 + 적분)
+		double totalMs = 0.0;
+		uint32_t activeDynamics = 0;
+		uint32_t broadPhaseAdds = 0;
+		uint32_t broadPhaseRemoves = 0;
+		uint32_t contactPairs = 0;
+		uint32_t outOfBounds = 0;	// MBP 영역을 벗어난 shape/aggregate 누적 수
+	};
+
 	class MMMENGINE_API PhysScene
 	{
 	public:
+		//롤백용 rigid 상태 (rigid 등록 순서대로 저장)
+		struct RigidStateEntry
+		{
+			MMMEngine::RigidBodyComponent* rb = nullptr;
+			MMMEngine::RigidBodyComponent::StateSnapshot state;
+		};
 		PhysScene() = default;
 		~PhysScene() { Destroy(); };
 
@@ -42,12 +69,30 @@ namespace MMMEngine
 		//시뮬레이션을 한 프레임 진행시키는 함수 //simulate 계산 시작, fetchResults 계산이 끝날때까지 대기 //멀티스레드
 		void Step(float dt);
 
+		//비동기 스텝용 분리 함수 //BeginStep은 simulate만 걸고 바로 리턴, EndStep에서 fetchResults
+		void BeginStep(float dt);
+		//block이 false면 아직 계산중일때 false 반환
+		bool EndStep(bool block = true);
+		bool IsSimulating() const { return m_isSimulating; }
+
+		//Step을 collide/advance로 나눠서 단계별 시간을 잼 (비동기 BeginStep에는 적용 안됨)
+		void SetStepProfiling(bool value) { m_stepProfiling = value; }
+		bool IsStepProfiling() const { return m_stepProfiling; }
+		const PhysStepStats& GetStepStats() const { return m_stepStats; }
+
 		void PullRigidsFromPhysics();
 		void ApplyInterpolation(float alpha);
+		//Transform이 바뀐 rigid만 물리에 반영
 		void SyncRigidsFromTransforms();
+		//직전 SyncRigidsFromTransforms에서 반영한 rigid 수
+		uint32_t GetLastSyncedRigidCount() const { return m_lastSyncedRigidCount; }
 
 		void DrainEvents();
 
+		//등록된 dynamic rigid의 pose/속도/수면 상태를 저장, 복원 //스텝 계산중에는 복원하지 않음
+		void CaptureRigidStates(std::vector<RigidStateEntry>& out) const;
+		void RestoreRigidStates(const std::vector<RigidStateEntry>& in);
+
 		//PxRigidActor를 PxScene에 등록 // add한순간부터 물리가 적용
 		void AddActor(physx::PxActor& actor);
 		//Scene에서 actor를 빼는 함수  //Scene에서 빠지면 더이상 시뮬안함
@@ -98,12 +143,39 @@ namespace MMMEngine
 
 		void TransferCollider(MMMEngine::RigidBodyComponent* oldRb, MMMEngine::RigidBodyComponent* newRb, MMMEngine::ColliderComponent* col, const CollisionMatrix& matrix);
 
+		//씬 쿼리 //layerMask는 shape query filter word0(레이어 비트)와 AND해서 0이면 제외
+		//layerMask가 0이면 아무것도 맞지 않음 (PhysX에 그대로 넘기면 전부 맞으므로 미리 리턴)
+		//읽기 전용이라 여러 스레드에서 동시에 호출 가능 (쿼리 도중 actor 추가/제거는 안됨)
+		bool Raycast(const physx::PxVec3& origin, const physx::PxVec3& unitDir, float maxDistance, physx::PxU32 layerMask, physx::PxRaycastHit& outHit) const;
+		bool Sweep(const physx::PxGeometry& geometry, const physx::PxTransform& pose, const physx::PxVec3& unitDir, float maxDistance, physx::PxU32 layerMask, physx::PxSweepHit& outHit) const;
+		//겹친 shape 수 반환 (maxHits 초과분은 버림)
+		physx::PxU32 Overlap(const physx::PxGeometry& geometry, const physx::PxTransform& pose, physx::PxU32 layerMask, physx::PxOverlapHit* outHits, physx::PxU32 maxHits) const;
+
 	private:
 		PhysSceneDesc m_desc;
 
 		physx::PxScene* m_scene = nullptr;
 		physx::PxDefaultCpuDispatcher* m_dispatcher = nullptr;
 
+		//simulate 호출 후 fetchResults 전까지 true
+		bool m_isSimulating = false;
+
+		uint32_t m_lastSyncedRigidCount = 0;
+
+		bool m_stepProfiling = false;
+		PhysStepStats m_stepStats;
+		void ProfiledStep(float dt);
+
+		//MBP 영역 밖으로 나간 shape 알림 (알림만 받고 처리는 하지 않음)
+		struct BroadPhaseBoundsCallback : public physx::PxBroadPhaseCallback
+		{
+			uint32_t outOfBoundsCount = 0;
+			void onObjectOutOfBounds(physx::PxShape&, physx::PxActor&) override { ++outOfBoundsCount; }
+			void onObjectOutOfBounds(physx::PxAggregate&) override { ++outOfBoundsCount; }
+		};
+		BroadPhaseBoundsCallback m_broadPhaseCallback;
+		void AddBroadPhaseRegions();
+
 		MMMEngine::PhysXSimulationCallback m_callback;
 
 		std::vector<MMMEngine::PhysXSimulationCallback::ContactEvent> m_frameContacts;
@@ -111,7 +183,36 @@ namespace MMMEngine
 
 
 		//해당 scene에서 사용되는 rigid 목록
-		std::unordered_set<MMMEngine::RigidBodyComponent*> m_rigids;
+		//포인터 해시 순서는 실행마다 달라지므로 등록 순서를 유지하는 배열로 보관 (Push/Sync/스냅샷 순서 고정)
+		std::vector<MMMEngine::RigidBodyComponent*> m_rigids;
+		std::unordered_map<MMMEngine::RigidBodyComponent*, size_t> m_rigidIndex;
+
+		bool HasRigid(MMMEngine::RigidBodyComponent* rb) const;
+		void AddRigidEntry(MMMEngine::RigidBodyComponent* rb);
+		void RemoveRigidEntry(MMMEngine::RigidBodyComponent* rb);
+
+		//Pull 때 active actor pose를 먼저 연속 배열로 읽어둔 뒤 일괄 반영
+		struct PulledPose
+		{
+			MMMEngine::RigidBodyComponent* rb;
+			physx::PxTransform pose;
+		};
+		std::vector<PulledPose> m_pulledPoses;
+
+		//직전 Pull에서 움직인 보간 대상 rigid (포인터 정렬 상태 유지)
+		std::vector<MMMEngine::RigidBodyComponent*> m_interpRigids;
+		std::vector<MMMEngine::RigidBodyComponent*> m_nextInterpRigids;
+
+		//ApplyInterpolation 일괄 계산용 버퍼
+		struct InterpPose
+		{
+			DirectX::SimpleMath::Vector3 prevPos;
+			DirectX::SimpleMath::Quaternion prevRot;
+			DirectX::SimpleMath::Vector3 currPos;
+			DirectX::SimpleMath::Quaternion currRot;
+		};
+		std::vector<MMMEngine::RigidBodyComponent*> m_interpBatch;
+		std::vector<InterpPose> m_interpPoses;
 		
 		//해당 shape가 어느 actor에 붙어있는지 ( 어떤 collider가 rigid에 붙었는지 )
 		std::unordered_map< MMMEngine::ColliderComponent*, MMMEngine::RigidBodyComponent*> m_ownerByCollider;
@@ -6,9 +6,40 @@
 //#include <physx/pvd/PxPvdTransport.h>
 #include "PhysXHelper.h"
 #include <physx/extensions/PxExtensionsAPI.h>
+#include <malloc.h>
 
 DEFINE_SINGLETON(MMMEngine::PhysicX)
 
+namespace
+{
+	// PhysX 16Ʈ  䱸ϹǷ  16Ʈ Ƽ ȯ ּ  
+	constexpr size_t kPxAllocHeader = 16;
+}
+
+MMMEngine::PhysXTrackingAllocator::PhysXTrackingAllocator()
+	: m_tag(MemoryTracker::Get().RegisterTag("Physics/PhysX"))
+{
+}
+
+void* MMMEngine::PhysXTrackingAllocator::allocate(size_t size, const char*, const char*, int)
+{
+	void* block = _aligned_malloc(size + kPxAllocHeader, 16);
+	if (!block) return nullptr;
+
+	*static_cast<size_t*>(block) = size;
+	MemoryTracker::Get().OnAlloc(m_tag, size);
+	return static_cast<uint8_t*>(block) + kPxAllocHeader;
+}
+
+void MMMEngine::PhysXTrackingAllocator::deallocate(void* ptr)
+{
+	if (!ptr) return;
+
+	uint8_t* block = static_cast<uint8_t*>(ptr) - kPxAllocHeader;
+	MemoryTracker::Get().OnFree(m_tag, *reinterpret_cast<size_t*>(block));
+	_aligned_free(block);
+}
+
 //   init Լ  
 bool MMMEngine::PhysicX::Initialize()
 {
@@ -27,6 +58,14 @@ bool MMMEngine::PhysicX::Initialize()
 
 bool MMMEngine::PhysicX::UnInitialize()
 {
+	//Ƽ PxPhysics   
+	for (auto& [id, entry] : m_materials)
+		SAFE_RELEASE(entry.material);
+	m_materials.clear();
+	m_materialLookup.clear();
+	m_nextMaterialID = 1;
+	SAFE_RELEASE(m_defaultMaterial);
+
 	SAFE_RELEASE(m_physics);
 	//SAFE_RELEASE(m_dispatcher);
 //#if defined(_DEBUG)
@@ -36,7 +75,6 @@ bool MMMEngine::PhysicX::UnInitialize()
 //#endif
 	// 
 	SAFE_RELEASE(m_foundation);
-	SAFE_RELEASE(m_defaultMaterial);
 	return true;
 }
 
@@ -47,7 +85,65 @@ physx::PxMaterial* MMMEngine::PhysicX::GetDefaultMaterial()
 
 physx::PxMaterial* MMMEngine::PhysicX::GetMaterial(MaterialID id)
 {
-	return m_defaultMaterial;
+	auto it = m_materials.find(id);
+	if (it == m_materials.end()) return m_defaultMaterial;
+	return it->second.material;
+}
+
+MMMEngine::PhysicX::MaterialID MMMEngine::PhysicX::RegisterMaterial(const PhysicsMaterialDesc& desc)
+{
+	if (!m_physics) return 0;
+
+	const MaterialKey key{ desc.staticFriction, desc.dynamicFriction, desc.restitution,
+		static_cast<int>(desc.frictionCombine), static_cast<int>(desc.restitutionCombine) };
+
+	auto it = m_materialLookup.find(key);
+	if (it != m_materialLookup.end())
+	{
+		++m_materials[it->second].refCount;
+		return it->second;
+	}
+
+	physx::PxMaterial* material = m_physics->createMaterial(desc.staticFriction, desc.dynamicFriction, desc.restitution);
+	if (!material) return 0;
+	material->setFrictionCombineMode(desc.frictionCombine);
+	material->setRestitutionCombineMode(desc.restitutionCombine);
+
+	const MaterialID id = m_nextMaterialID++;
+	m_materials[id] = MaterialEntry{ material, key, 1 };
+	m_materialLookup.emplace(key, id);
+	return id;
+}
+
+void MMMEngine::PhysicX::ReleaseMaterial(MaterialID id)
+{
+	auto it = m_materials.find(id);
+	if (it == m_materials.end()) return;	// 0(⺻ Ƽ)̰ų UnInitialize 
+
+	MaterialEntry& entry = it->second;
+	if (entry.refCount > 1)
+	{
+		--entry.refCount;
+		return;
+	}
+
+	// ݶ̴  ٷ  (̴    ߰   ʰ)
+	m_materialLookup.erase(entry.key);
+	SAFE_RELEASE(entry.material);
+	m_materials.erase(it);
+}
+
+MMMEngine::PhysicsMemoryStats MMMEngine::PhysicX::GetMemoryStats() const
+{
+	PhysicsMemoryStats stats;
+	stats.sharedMaterialCount = static_cast<uint32_t>(m_materials.size());
+	if (!m_physics) return stats;
+
+	stats.shapeCount = m_physics->getNbShapes();
+	stats.materialCount = m_physics->getNbMaterials();
+	stats.convexMeshCount = m_physics->getNbConvexMeshes();
+	stats.triangleMeshCount = m_physics->getNbTriangleMeshes();
+	return stats;
 }
 
 bool MMMEngine::PhysicX::InitTolerances(float _length, float _speed)
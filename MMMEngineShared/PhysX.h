@@ -1,8 +1,11 @@
 #pragma once
 #include <optional>
 #include "ExportSingleton.hpp"
+#include "MemoryTracker.h"
 #include <physx/PxPhysicsAPI.h>
 #include <unordered_map>
+#include <map>
+#include <tuple>
 
 
 struct TolerancesScale
@@ -13,6 +16,41 @@ struct TolerancesScale
 
 namespace MMMEngine
 {
+	// ݶ̴ Ƽ  ( ̸ PxMaterial ϳ )
+	struct PhysicsMaterialDesc
+	{
+		float staticFriction = 0.5f;
+		float dynamicFriction = 0.5f;
+		float restitution = 0.0f;
+		physx::PxCombineMode::Enum frictionCombine = physx::PxCombineMode::eAVERAGE;
+		physx::PxCombineMode::Enum restitutionCombine = physx::PxCombineMode::eAVERAGE;
+	};
+
+	// PhysX ü  (ߺ   Ȯο)
+	struct PhysicsMemoryStats
+	{
+		uint32_t shapeCount = 0;
+		uint32_t materialCount = 0;			// PxPhysics ü Ƽ 
+		uint32_t sharedMaterialCount = 0;	// Ʈ ϵ  Ƽ 
+		uint32_t convexMeshCount = 0;
+		uint32_t triangleMeshCount = 0;
+	};
+
+	// PxDefaultAllocator   Ҵ
+	// 16Ʈ  ״ ΰ տ ũ  ٿ MemoryTracker "Physics/PhysX" ±׷ 
+	class MMMENGINE_API PhysXTrackingAllocator : public physx::PxAllocatorCallback
+	{
+	public:
+		PhysXTrackingAllocator();
+
+		void* allocate(size_t size, const char* typeName, const char* filename, int line) override;
+		void deallocate(void* ptr) override;
+
+	private:
+		// PhysX Ŀ 忡 ҸǷ  (PhysicX , Ŀ̼  ) ѹ ϰ  б⸸ 
+		const MemoryTag m_tag;
+	};
+
 	class MMMENGINE_API PhysicX : public Utility::ExportSingleton<PhysicX>
 	{
 	public:
@@ -44,11 +82,20 @@ namespace MMMEngine
 		physx::PxMaterial* GetDefaultMaterial();
 		physx::PxMaterial* GetMaterial(MaterialID id);
 
+		//   Ƽ ̹   ID ȯ,     ( īƮ +1)
+		//  ü ȯ Ƽ   ٲٸ ȵ ( ٲ ٽ ؼ ü)
+		MaterialID RegisterMaterial(const PhysicsMaterialDesc& desc);
+		// RegisterMaterial  ŭ ȣ,  0 Ǹ Ʈ  PxMaterial 
+		// (̹ پ ִ shape PhysX    )
+		void ReleaseMaterial(MaterialID id);
+
+		PhysicsMemoryStats GetMemoryStats() const;
+
 	private:
 		//PhysX SDK /ھ   ü, ޸ Ҵ/ü å , /α ݹ ,  ҽ/  ʱȭ
 		//  Ǿϰ   ıǾ
 		physx::PxFoundation* m_foundation = nullptr;
-		physx::PxDefaultAllocator m_allocator{};
+		PhysXTrackingAllocator m_allocator{};
 		physx::PxDefaultErrorCallback m_errorCallback{};
 
 		//   ھ ( PxScene, PxMaterial, PxRigidActor  ϴ 丮 )
@@ -67,8 +114,17 @@ namespace MMMEngine
 		//physx::PxPvdTransport* transport = nullptr;
 
 
-		physx::PxMaterial* m_defaultMaterial;
-		std::unordered_map<MaterialID, physx::PxMaterial*> m_materials;
+		physx::PxMaterial* m_defaultMaterial = nullptr;
+		using MaterialKey = std::tuple<float, float, float, int, int>;
+		struct MaterialEntry
+		{
+			physx::PxMaterial* material = nullptr;
+			MaterialKey key;
+			uint32_t refCount = 0;
+		};
+		std::unordered_map<MaterialID, MaterialEntry> m_materials;
+		std::map<MaterialKey, MaterialID> m_materialLookup;
+		MaterialID m_nextMaterialID = 1;	// 0 ⺻ Ƽ
 
 		int threadCount;
 
@@ -3,8 +3,6 @@
 //물리 접촉 이벤트 수집
 void MMMEngine::PhysXSimulationCallback::onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs)
 {
-    std::lock_guard<std::mutex> lock(m_mtx);
-
     physx::PxActor* actorA = pairHeader.actors[0];
     physx::PxActor* actorB = pairHeader.actors[1];
 
@@ -41,9 +39,9 @@ void MMMEngine::PhysXSimulationCallback::onContact(const physx::PxContactPairHea
         float bestDepth = 0.f;
 
         // LOST의 경우 접촉점이 없을 수 있으니 방어코드 필요
-        // contact point 추출
+        // contact point 추출 //eNOTIFY_CONTACT_POINTS를 요청한 pair만 contactCount가 있음
         physx::PxContactPairPoint cps[16];
-        const physx::PxU32 nbContacts = cp.extractContacts(cps, 16);
+        const physx::PxU32 nbContacts = (cp.contactCount > 0) ? cp.extractContacts(cps, 16) : 0;
 
         if (nbContacts > 0)
         {
@@ -73,8 +71,6 @@ void MMMEngine::PhysXSimulationCallback::onContact(const physx::PxContactPairHea
 
 void MMMEngine::PhysXSimulationCallback::onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count)
 {
-    std::lock_guard<std::mutex> lock(m_mtx);
-
     for (physx::PxU32 i = 0; i < count; ++i)
     {
         const auto& p = pairs[i];
@@ -105,35 +101,20 @@ void MMMEngine::PhysXSimulationCallback::onTrigger(physx::PxTriggerPair* pairs,
 
 void MMMEngine::PhysXSimulationCallback::DrainContacts(std::vector<ContactEvent>& out)
 {
-    std::vector<ContactEvent> tmp;
-    {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        tmp.swap(m_contacts);
-    }
-    // 락 밖에서 out에 합치기
-    out.insert(out.end(), tmp.begin(), tmp.end());
-
-    //out.insert(out.end(), m_contacts.begin(), m_contacts.end());
-    //m_contacts.clear();
+    // 더블 버퍼 : 이전 프레임 버퍼(out)를 비워서 다음 수집용으로 돌려받음
+    out.clear();
+    out.swap(m_contacts);
 }
 
 void MMMEngine::PhysXSimulationCallback::DrainTriggers(std::vector<TriggerEvent>& out)
 {
-    std::vector<TriggerEvent> tmp;
-    {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        tmp.swap(m_triggers);
-    }
-    out.insert(out.end(), tmp.begin(), tmp.end());
-
-    //out.insert(out.end(), m_triggers.begin(), m_triggers.end());
-    //m_triggers.clear();
+    out.clear();
+    out.swap(m_triggers);
 }
 
 
 void MMMEngine::PhysXSimulationCallback::Clear()
 {
-    std::lock_guard<std::mutex> lock(m_mtx);
     m_contacts.clear();
     m_triggers.clear();
 }
@@ -2,7 +2,6 @@
 #include <physx/PxPhysicsAPI.h>
 #include <iostream>
 #include <vector>
-#include <mutex>
 #include "Export.h"
 
 
@@ -50,6 +49,8 @@ namespace MMMEngine
 		//physx::PxU32 events; 트리거에서 events를 안쓰는 이유는 지금단계에서는 event enter/exit로만 나눴음
 
 		//콜백 내부에서는 수집만 함
+		//onContact/onTrigger는 fetchResults를 호출한 스레드에서만 불리므로 락 없이 바로 쌓음
+		//(Drain도 같은 스레드(SyncStep)에서 호출해야 함)
 
 		void onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs) override;
 
@@ -60,6 +61,7 @@ namespace MMMEngine
 		const std::vector<ContactEvent>& GetContacts() const { return m_contacts; }
 		const std::vector<TriggerEvent>& GetTriggers() const { return m_triggers; }
 
+		//쌓인 이벤트를 out과 교체 (out은 비워진 뒤 다음 수집 버퍼가 됨) //복사 없음, 용량 재사용
 		void DrainContacts(std::vector<ContactEvent>& out);
 
 		void DrainTriggers(std::vector<TriggerEvent>& out);
@@ -80,7 +82,6 @@ namespace MMMEngine
 		//시뮬레이션 결과 pose가 준비된 시점에 결과 pose 배열을 콜백으로 넘겨주는 메커니즘
 		void onAdvance(const physx::PxRigidBody* const*, const physx::PxTransform*, const physx::PxU32) override {};
 	private:
-		std::mutex m_mtx;
 		std::vector<ContactEvent> m_contacts;
 		std::vector<TriggerEvent> m_triggers;
 	};
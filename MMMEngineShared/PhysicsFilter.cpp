@@ -31,7 +31,10 @@ physx::PxFilterFlags MMMEngine::CustomFilterShader(physx::PxFilterObjectAttribut
     pairFlags |= physx::PxPairFlag::eNOTIFY_TOUCH_FOUND;
     pairFlags |= physx::PxPairFlag::eNOTIFY_TOUCH_LOST;
     pairFlags |= physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS; // 콜백이 원하면
-    pairFlags |= physx::PxPairFlag::eNOTIFY_CONTACT_POINTS;
+
+    //접촉 정보가 필요한 shape가 낀 pair만 contact point를 받음 (나머지는 추출 비용 없음)
+    if ((filterData0.word2 | filterData1.word2) & SIMFILTER_CONTACT_DETAILS)
+        pairFlags |= physx::PxPairFlag::eNOTIFY_CONTACT_POINTS;
 
     return physx::PxFilterFlag::eDEFAULT;
 }
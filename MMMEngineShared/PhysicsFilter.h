@@ -1,8 +1,12 @@
-#pragma once
+﻿#pragma once
+#include "Export.h"
 #include <physx/PxPhysicsAPI.h>
 
 namespace MMMEngine {
-	physx::PxFilterFlags CustomFilterShader(
+	// sim filter word2 비트 : 이 shape가 contact point(법선/접촉점/침투깊이)를 필요로 함
+	constexpr physx::PxU32 SIMFILTER_CONTACT_DETAILS = 1u << 0;
+
+	MMMENGINE_API physx::PxFilterFlags CustomFilterShader(
 		physx::PxFilterObjectAttributes attributes0,
 		physx::PxFilterData filterData0,
 		physx::PxFilterObjectAttributes attributes1,
@@ -0,0 +1,383 @@
+﻿#include "PhysicsMeshCache.h"
+#include "PhysX.h"
+#include "ResourceManager.h"
+#include "StaticMesh.h"
+#include <physx/cooking/PxCooking.h>
+#include <physx/extensions/PxDefaultStreams.h>
+#include <chrono>
+#include <fstream>
+#include <cstdio>
+
+DEFINE_SINGLETON(MMMEngine::PhysicsMeshCache)
+
+namespace
+{
+	// 캐시 파일 헤더 (쿠킹 파라미터/포맷이 바뀌면 버전 올려서 기존 캐시 무효화)
+	constexpr uint32_t kCacheMagic = 0x4350434D; // "MCPC"
+	constexpr uint32_t kCacheVersion = 1;
+
+	struct CacheFileHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t type;
+		uint32_t size;
+	};
+
+	using CacheClock = std::chrono::steady_clock;
+
+	double ElapsedMs(CacheClock::time_point _start)
+	{
+		return std::chrono::duration<double, std::milli>(CacheClock::now() - _start).count();
+	}
+
+	// FNV-1a 64
+	void HashBytes(uint64_t& _hash, const void* _data, size_t _size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+		for (size_t i = 0; i < _size; ++i)
+		{
+			_hash ^= bytes[i];
+			_hash *= 0x100000001b3ULL;
+		}
+	}
+}
+
+uint64_t MMMEngine::PhysicsMeshCache::ComputeHash(const MeshData& _data)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	const uint64_t subMeshCount = _data.vertices.size();
+	HashBytes(hash, &subMeshCount, sizeof(subMeshCount));
+
+	for (size_t i = 0; i < _data.vertices.size(); ++i)
+	{
+		const auto& vertices = _data.vertices[i];
+		const uint64_t vertexCount = vertices.size();
+		HashBytes(hash, &vertexCount, sizeof(vertexCount));
+		for (const auto& v : vertices)
+			HashBytes(hash, &v.Pos, sizeof(v.Pos));
+
+		if (i < _data.indices.size())
+		{
+			const auto& indices = _data.indices[i];
+			const uint64_t indexCount = indices.size();
+			HashBytes(hash, &indexCount, sizeof(indexCount));
+			if (!indices.empty())
+				HashBytes(hash, indices.data(), sizeof(UINT) * indices.size());
+		}
+	}
+
+	return hash == 0 ? 1 : hash;
+}
+
+void MMMEngine::PhysicsMeshCache::BuildSource(const MeshData& _data, MeshSource& _out)
+{
+	_out.points.clear();
+	_out.indices.clear();
+
+	for (size_t i = 0; i < _data.vertices.size(); ++i)
+	{
+		const physx::PxU32 baseIndex = static_cast<physx::PxU32>(_out.points.size());
+		for (const auto& v : _data.vertices[i])
+			_out.points.emplace_back(v.Pos.x, v.Pos.y, v.Pos.z);
+
+		if (i < _data.indices.size())
+		{
+			for (UINT idx : _data.indices[i])
+				_out.indices.push_back(baseIndex + idx);
+		}
+	}
+}
+
+std::filesystem::path MMMEngine::PhysicsMeshCache::GetCachePath(uint64_t _hash, PhysicsMeshType _type) const
+{
+	char name[64];
+	std::snprintf(name, sizeof(name), "%016llx_%s.pxc",
+		static_cast<unsigned long long>(_hash),
+		_type == PhysicsMeshType::Convex ? "convex" : "tri");
+
+	return ResourceManager::Get().GetCurrentRootPath() / L"Cache" / L"PhysicsMesh" / name;
+}
+
+bool MMMEngine::PhysicsMeshCache::Cook(const MeshSource& _source, PhysicsMeshType _type, std::vector<uint8_t>& _outBytes)
+{
+	if (_source.points.empty()) return false;
+
+	const auto start = CacheClock::now();
+	const physx::PxCookingParams& params = PhysicX::Get().GetCookParam();
+	physx::PxDefaultMemoryOutputStream stream;
+	bool ok = false;
+
+	if (_type == PhysicsMeshType::Convex)
+	{
+		physx::PxConvexMeshDesc desc;
+		desc.points.count = static_cast<physx::PxU32>(_source.points.size());
+		desc.points.stride = sizeof(physx::PxVec3);
+		desc.points.data = _source.points.data();
+		desc.flags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
+
+		ok = PxCookConvexMesh(params, desc, stream);
+	}
+	else
+	{
+		if (_source.indices.size() < 3) return false;
+
+		physx::PxTriangleMeshDesc desc;
+		desc.points.count = static_cast<physx::PxU32>(_source.points.size());
+		desc.points.stride = sizeof(physx::PxVec3);
+		desc.points.data = _source.points.data();
+		desc.triangles.count = static_cast<physx::PxU32>(_source.indices.size() / 3);
+		desc.triangles.stride = sizeof(physx::PxU32) * 3;
+		desc.triangles.data = _source.indices.data();
+
+		ok = PxCookTriangleMesh(params, desc, stream);
+	}
+
+	if (!ok) return false;
+
+	_outBytes.assign(stream.getData(), stream.getData() + stream.getSize());
+
+	++m_stats.cookCount;
+	m_stats.cookMs += ElapsedMs(start);
+	return true;
+}
+
+bool MMMEngine::PhysicsMeshCache::WriteCacheFile(uint64_t _hash, PhysicsMeshType _type, const std::vector<uint8_t>& _bytes) const
+{
+	const auto path = GetCachePath(_hash, _type);
+
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file) return false;
+
+	const CacheFileHeader header{ kCacheMagic, kCacheVersion, static_cast<uint32_t>(_type), static_cast<uint32_t>(_bytes.size()) };
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(_bytes.data()), _bytes.size());
+	return file.good();
+}
+
+MMMEngine::PhysicsMeshCache::CacheFileState MMMEngine::PhysicsMeshCache::ReadCacheFile(uint64_t _hash, PhysicsMeshType _type, std::vector<uint8_t>& _outBytes) const
+{
+	std::ifstream file(GetCachePath(_hash, _type), std::ios::binary);
+	if (!file) return CacheFileState::Missing;
+
+	CacheFileHeader header{};
+	file.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if (!file
+		|| header.magic != kCacheMagic
+		|| header.version != kCacheVersion
+		|| header.type != static_cast<uint32_t>(_type))
+		return CacheFileState::Missing;
+
+	// 크기 0 = 쿠킹 실패 기록
+	if (header.size == 0)
+		return CacheFileState::CookFailed;
+
+	_outBytes.resize(header.size);
+	file.read(reinterpret_cast<char*>(_outBytes.data()), header.size);
+	return file.good() ? CacheFileState::Ready : CacheFileState::Missing;
+}
+
+bool MMMEngine::PhysicsMeshCache::IsCookFailed(uint64_t _hash, PhysicsMeshType _type) const
+{
+	const auto& failed = _type == PhysicsMeshType::Convex ? m_failedConvex : m_failedTriangle;
+	return failed.find(_hash) != failed.end();
+}
+
+void MMMEngine::PhysicsMeshCache::RecordCookFailure(uint64_t _hash, PhysicsMeshType _type)
+{
+	auto& failed = _type == PhysicsMeshType::Convex ? m_failedConvex : m_failedTriangle;
+	failed.insert(_hash);
+
+	// 다음 실행에서도 다시 쿠킹하지 않게 실패 기록을 남김 (메시 내용이 바뀌면 해시도 바뀜)
+	WriteCacheFile(_hash, _type, {});
+}
+
+bool MMMEngine::PhysicsMeshCache::HasMesh(uint64_t _hash, PhysicsMeshType _type) const
+{
+	if (_type == PhysicsMeshType::Convex)
+		return m_convexMeshes.find(_hash) != m_convexMeshes.end();
+	return m_triangleMeshes.find(_hash) != m_triangleMeshes.end();
+}
+
+bool MMMEngine::PhysicsMeshCache::AcquireCookedBytes(uint64_t _hash, PhysicsMeshType _type, std::vector<uint8_t>& _outBytes, bool& _outCooked)
+{
+	_outCooked = false;
+	if (IsCookFailed(_hash, _type))
+		return false;
+
+	switch (ReadCacheFile(_hash, _type, _outBytes))
+	{
+	case CacheFileState::Ready:
+		return true;
+	case CacheFileState::CookFailed:
+		(_type == PhysicsMeshType::Convex ? m_failedConvex : m_failedTriangle).insert(_hash);
+		return false;
+	default:
+		break;
+	}
+
+	// 캐시가 없으면 보관해둔 CPU 데이터로 쿠킹 후 저장
+	auto it = m_sources.find(_hash);
+	if (it == m_sources.end())
+		return false;
+
+	if (!Cook(it->second, _type, _outBytes))
+	{
+		RecordCookFailure(_hash, _type);
+		return false;
+	}
+
+	WriteCacheFile(_hash, _type, _outBytes);
+	_outCooked = true;
+	return true;
+}
+
+void MMMEngine::PhysicsMeshCache::CookToCache(uint64_t _hash, const MeshData& _data)
+{
+	if (_hash == 0) return;
+	if (m_sources.find(_hash) != m_sources.end()) return;
+
+	// 쿠킹 결과나 실패 기록이 이미 있으면 건너뜀
+	const bool hasConvex = IsCookFailed(_hash, PhysicsMeshType::Convex)
+		|| std::filesystem::exists(GetCachePath(_hash, PhysicsMeshType::Convex));
+	const bool hasTriangle = IsCookFailed(_hash, PhysicsMeshType::Triangle)
+		|| std::filesystem::exists(GetCachePath(_hash, PhysicsMeshType::Triangle));
+	if (hasConvex && hasTriangle) return;
+
+	MeshSource source;
+	BuildSource(_data, source);
+
+	bool allWritten = true;
+	std::vector<uint8_t> bytes;
+	for (PhysicsMeshType type : { PhysicsMeshType::Convex, PhysicsMeshType::Triangle })
+	{
+		if (type == PhysicsMeshType::Convex ? hasConvex : hasTriangle)
+			continue;
+
+		// 쿠킹 자체가 실패한 메시(면이 없음 등)는 다시 시도해도 똑같으니 실패만 기록
+		if (!Cook(source, type, bytes))
+		{
+			RecordCookFailure(_hash, type);
+			continue;
+		}
+
+		if (!WriteCacheFile(_hash, type, bytes))
+			allWritten = false;
+	}
+
+	if (!allWritten)
+		m_sources.emplace(_hash, std::move(source));
+}
+
+bool MMMEngine::PhysicsMeshCache::PrepareMesh(StaticMesh& _mesh, PhysicsMeshType _type)
+{
+	const uint64_t hash = _mesh.collisionHash;
+	if (hash != 0)
+	{
+		if (HasMesh(hash, _type)) return true;
+		if (IsCookFailed(hash, _type)) return false;
+		if (m_sources.find(hash) != m_sources.end()
+			|| std::filesystem::exists(GetCachePath(hash, _type)))
+			return true;
+	}
+
+	// 캐시 파일이 없으면 (다른 PC에서 임포트, 캐시 삭제, 이전 에셋) 메시 데이터를 다시 읽어 한번 쿠킹
+	MeshData data;
+	if (!_mesh.LoadCollisionSource(data))
+		return false;
+
+	if (hash == 0)
+		_mesh.collisionHash = ComputeHash(data);
+
+	CookToCache(_mesh.collisionHash, data);
+	return !IsCookFailed(_mesh.collisionHash, _type);
+}
+
+physx::PxConvexMesh* MMMEngine::PhysicsMeshCache::GetConvexMesh(StaticMesh& _mesh)
+{
+	if (!PrepareMesh(_mesh, PhysicsMeshType::Convex))
+		return nullptr;
+	return GetConvexMesh(_mesh.collisionHash);
+}
+
+physx::PxTriangleMesh* MMMEngine::PhysicsMeshCache::GetTriangleMesh(StaticMesh& _mesh)
+{
+	if (!PrepareMesh(_mesh, PhysicsMeshType::Triangle))
+		return nullptr;
+	return GetTriangleMesh(_mesh.collisionHash);
+}
+
+physx::PxConvexMesh* MMMEngine::PhysicsMeshCache::GetConvexMesh(uint64_t _hash)
+{
+	if (_hash == 0) return nullptr;
+
+	if (auto it = m_convexMeshes.find(_hash); it != m_convexMeshes.end())
+		return it->second;
+
+	// 캐시 파일 읽기 + 역직렬화 시간을 load 로 집계 (쿠킹한 경우는 cook 에 집계됨)
+	const auto start = CacheClock::now();
+	std::vector<uint8_t> bytes;
+	bool cooked = false;
+	if (!AcquireCookedBytes(_hash, PhysicsMeshType::Convex, bytes, cooked))
+		return nullptr;
+
+	physx::PxDefaultMemoryInputData input(bytes.data(), static_cast<physx::PxU32>(bytes.size()));
+	physx::PxConvexMesh* mesh = PhysicX::Get().GetPhysics().createConvexMesh(input);
+	if (!mesh) return nullptr;
+
+	if (!cooked)
+	{
+		++m_stats.loadCount;
+		m_stats.loadMs += ElapsedMs(start);
+	}
+
+	m_convexMeshes[_hash] = mesh;
+	return mesh;
+}
+
+physx::PxTriangleMesh* MMMEngine::PhysicsMeshCache::GetTriangleMesh(uint64_t _hash)
+{
+	if (_hash == 0) return nullptr;
+
+	if (auto it = m_triangleMeshes.find(_hash); it != m_triangleMeshes.end())
+		return it->second;
+
+	// 캐시 파일 읽기 + 역직렬화 시간을 load 로 집계 (쿠킹한 경우는 cook 에 집계됨)
+	const auto start = CacheClock::now();
+	std::vector<uint8_t> bytes;
+	bool cooked = false;
+	if (!AcquireCookedBytes(_hash, PhysicsMeshType::Triangle, bytes, cooked))
+		return nullptr;
+
+	physx::PxDefaultMemoryInputData input(bytes.data(), static_cast<physx::PxU32>(bytes.size()));
+	physx::PxTriangleMesh* mesh = PhysicX::Get().GetPhysics().createTriangleMesh(input);
+	if (!mesh) return nullptr;
+
+	if (!cooked)
+	{
+		++m_stats.loadCount;
+		m_stats.loadMs += ElapsedMs(start);
+	}
+
+	m_triangleMeshes[_hash] = mesh;
+	return mesh;
+}
+
+void MMMEngine::PhysicsMeshCache::ShutDown()
+{
+	// shape가 잡고 있는 참조는 남아있으니 캐시 참조만 해제
+	for (auto& [hash, mesh] : m_convexMeshes)
+		if (mesh) mesh->release();
+	for (auto& [hash, mesh] : m_triangleMeshes)
+		if (mesh) mesh->release();
+
+	m_convexMeshes.clear();
+	m_triangleMeshes.clear();
+	m_sources.clear();
+	m_failedConvex.clear();
+	m_failedTriangle.clear();
+}
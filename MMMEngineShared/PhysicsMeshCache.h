@@ -0,0 +1,89 @@
+﻿#pragma once
+#include "ExportSingleton.hpp"
+#include "RenderShared.h"
+#include <physx/PxPhysicsAPI.h>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace MMMEngine
+{
+	class StaticMesh;
+
+	enum class PhysicsMeshType { Convex, Triangle };
+
+	struct PhysicsMeshCacheStats
+	{
+		uint32_t cookCount = 0;		// 직접 쿠킹한 횟수
+		uint32_t loadCount = 0;		// 디스크 캐시에서 역직렬화한 횟수
+		double cookMs = 0.0;
+		double loadMs = 0.0;
+	};
+
+	// 메시 콜라이더용 쿠킹 결과 캐시
+	// 메시 내용 해시로 키를 잡아서 <root>/Cache/PhysicsMesh 에 쿠킹 결과를 저장하고, 런타임에는 역직렬화만 함
+	// 쿠킹은 임포트 시점(캐시가 없던 메시는 콜라이더가 처음 요청할 때)에 메시 내용당 한번만 일어남
+	// 쿠킹이 실패한 메시(볼록 껍질이 안 나오는 등)는 실패 기록 파일을 남겨서 다시 쿠킹하지 않음
+	class MMMENGINE_API PhysicsMeshCache : public Utility::ExportSingleton<PhysicsMeshCache>
+	{
+		friend class Utility::ExportSingleton<PhysicsMeshCache>;
+	private:
+		PhysicsMeshCache() = default;
+		~PhysicsMeshCache() = default;
+
+		// 서브메시를 하나로 합친 쿠킹 입력
+		struct MeshSource
+		{
+			std::vector<physx::PxVec3> points;
+			std::vector<physx::PxU32> indices;
+		};
+
+		std::unordered_map<uint64_t, MeshSource> m_sources;
+		std::unordered_map<uint64_t, physx::PxConvexMesh*> m_convexMeshes;
+		std::unordered_map<uint64_t, physx::PxTriangleMesh*> m_triangleMeshes;
+		std::unordered_set<uint64_t> m_failedConvex;
+		std::unordered_set<uint64_t> m_failedTriangle;
+
+		PhysicsMeshCacheStats m_stats;
+
+		static void BuildSource(const MeshData& _data, MeshSource& _out);
+		std::filesystem::path GetCachePath(uint64_t _hash, PhysicsMeshType _type) const;
+
+		bool Cook(const MeshSource& _source, PhysicsMeshType _type, std::vector<uint8_t>& _outBytes);
+		enum class CacheFileState { Missing, Ready, CookFailed };
+
+		// _bytes 가 비어 있으면 쿠킹 실패 기록으로 저장됨
+		bool WriteCacheFile(uint64_t _hash, PhysicsMeshType _type, const std::vector<uint8_t>& _bytes) const;
+		CacheFileState ReadCacheFile(uint64_t _hash, PhysicsMeshType _type, std::vector<uint8_t>& _outBytes) const;
+
+		bool IsCookFailed(uint64_t _hash, PhysicsMeshType _type) const;
+		void RecordCookFailure(uint64_t _hash, PhysicsMeshType _type);
+		bool HasMesh(uint64_t _hash, PhysicsMeshType _type) const;
+		// 캐시에 없는 메시면 에셋에서 메시 데이터를 다시 읽어 쿠킹 (해시가 없던 이전 에셋은 여기서 계산)
+		bool PrepareMesh(StaticMesh& _mesh, PhysicsMeshType _type);
+		// 캐시 파일 -> 쿠킹 순서로 쿠킹 결과를 얻음
+		bool AcquireCookedBytes(uint64_t _hash, PhysicsMeshType _type, std::vector<uint8_t>& _outBytes, bool& _outCooked);
+
+	public:
+		// 정점 위치 + 인덱스 기준 내용 해시 (0은 무효값으로 씀)
+		static uint64_t ComputeHash(const MeshData& _data);
+
+		// 임포트 시점에 호출 : 캐시 파일이 없으면 쿠킹해서 저장
+		// 저장에 실패하면 (읽기 전용 경로 등) 요청시 다시 쿠킹할 수 있게 CPU 데이터를 보관
+		void CookToCache(uint64_t _hash, const MeshData& _data);
+
+		// 캐시가 소유한 메시 반환 (shape가 자기 참조를 따로 잡으므로 호출자는 release 하지 않음) //실패시 nullptr
+		physx::PxConvexMesh* GetConvexMesh(uint64_t _hash);
+		physx::PxTriangleMesh* GetTriangleMesh(uint64_t _hash);
+
+		// 콜라이더용 진입점 : 캐시 파일이 없으면 이 시점에 한번 쿠킹
+		physx::PxConvexMesh* GetConvexMesh(StaticMesh& _mesh);
+		physx::PxTriangleMesh* GetTriangleMesh(StaticMesh& _mesh);
+
+		const PhysicsMeshCacheStats& GetStats() const { return m_stats; }
+		void ResetStats() { m_stats = {}; }
+
+		void ShutDown();
+	};
+}
@@ -29,6 +29,11 @@ bool MMMEngine::PhysicsSettings::SaveSettings()
         std::vector<uint32_t> matrixVec(collisionMatrix, collisionMatrix + 32);
         j["CollisionMatrix"] = matrixVec;
 
+        j["BroadPhaseType"] = static_cast<uint32_t>(broadPhaseType);
+        j["WorldBoundsMin"] = std::vector<float>(worldBoundsMin, worldBoundsMin + 3);
+        j["WorldBoundsMax"] = std::vector<float>(worldBoundsMax, worldBoundsMax + 3);
+        j["BroadPhaseSubdivisions"] = broadPhaseSubdivisions;
+
         // 1. JSON을 MessagePack 바이너리로 변환
         std::vector<std::uint8_t> v_msgpack = json::to_msgpack(j);
 
@@ -70,6 +75,22 @@ bool MMMEngine::PhysicsSettings::LoadSettings()
                 collisionMatrix[i] = matrixVec[i];
             }
         }
+
+        // 이전 버전 설정 파일에는 없으므로 있을때만 읽음
+        if (j.contains("BroadPhaseType")) {
+            broadPhaseType = static_cast<BroadPhaseType>(j["BroadPhaseType"].get<uint32_t>());
+        }
+        if (j.contains("WorldBoundsMin")) {
+            auto v = j["WorldBoundsMin"].get<std::vector<float>>();
+            for (size_t i = 0; i < 3 && i < v.size(); ++i) worldBoundsMin[i] = v[i];
+        }
+        if (j.contains("WorldBoundsMax")) {
+            auto v = j["WorldBoundsMax"].get<std::vector<float>>();
+            for (size_t i = 0; i < 3 && i < v.size(); ++i) worldBoundsMax[i] = v[i];
+        }
+        if (j.contains("BroadPhaseSubdivisions")) {
+            broadPhaseSubdivisions = j["BroadPhaseSubdivisions"].get<uint32_t>();
+        }
         return true;
     }
     catch (const std::exception& e) {
@@ -90,4 +111,16 @@ void MMMEngine::PhysicsSettings::ApplySettings()
             physx.SetLayerCollision(i, j, canCollide);
         }
     }
+
+    physx::PxBroadPhaseType::Enum pxType = physx::PxBroadPhaseType::ePABP;
+    switch (broadPhaseType) {
+    case BroadPhaseType::ABP: pxType = physx::PxBroadPhaseType::eABP; break;
+    case BroadPhaseType::MBP: pxType = physx::PxBroadPhaseType::eMBP; break;
+    default: break;
+    }
+
+    const physx::PxBounds3 bounds(
+        physx::PxVec3(worldBoundsMin[0], worldBoundsMin[1], worldBoundsMin[2]),
+        physx::PxVec3(worldBoundsMax[0], worldBoundsMax[1], worldBoundsMax[2]));
+    physx.SetBroadPhase(pxType, bounds, broadPhaseSubdivisions);
 }
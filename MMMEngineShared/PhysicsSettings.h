@@ -4,6 +4,14 @@
 
 namespace MMMEngine
 {
+	// 브로드페이즈 알고리즘 (PxBroadPhaseType 대응)
+	enum class BroadPhaseType : uint32_t
+	{
+		PABP = 0,	// 기본값, 병렬 ABP
+		ABP,
+		MBP			// 넓은 맵용, 월드 범위를 영역으로 나눠서 관리
+	};
+
 	class MMMENGINE_API PhysicsSettings : public Utility::ExportSingleton<PhysicsSettings>
 	{
 	public:
@@ -40,6 +48,12 @@ namespace MMMEngine
 
 		std::map<uint32_t, std::string> idToName;
 		uint32_t collisionMatrix[32] = { 0, };
+
+		// 브로드페이즈 (씬을 새로 만들때 적용됨)
+		BroadPhaseType broadPhaseType = BroadPhaseType::PABP;
+		float worldBoundsMin[3] = { -1000.f, -1000.f, -1000.f };
+		float worldBoundsMax[3] = { 1000.f, 1000.f, 1000.f };
+		uint32_t broadPhaseSubdivisions = 8;	// MBP 영역 수 = subdivisions^2 (최대 16)
 	private:
 		std::filesystem::path m_configFilePath;
 		const std::string SETTINGS_FILENAME = "physics.settings";
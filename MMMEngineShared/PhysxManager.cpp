@@ -4,6 +4,9 @@
 #include "BehaviourManager.h"
 #include "PhysxHelper.h"
 #include "Transform.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
 
 DEFINE_SINGLETON(MMMEngine::PhysxManager)
 
@@ -18,6 +21,10 @@ void MMMEngine::PhysxManager::BindScene(MMMEngine::Scene* scene)
 
     // 씬 설정으로 desc 구성 (임시라도)
     PhysSceneDesc desc{};
+    desc.enableEnhancedDeterminism = m_Deterministic;
+    desc.broadPhaseType = m_BroadPhaseType;
+    desc.worldBounds = m_WorldBounds;
+    desc.broadPhaseSubdivisions = m_BroadPhaseSubdivisions;
 
     for (uint32_t i = 0; i <= 4; ++i)
     {
@@ -41,7 +48,9 @@ void MMMEngine::PhysxManager::BindScene(MMMEngine::Scene* scene)
 
 void MMMEngine::PhysxManager::SetStep()
 {
+    MMM_PROFILE_FUNCTION();
     if (!m_IsInitialized) return;
+    SyncStep();                  // 계산중인 스텝이 있으면 먼저 반영 (씬 변경 전)
     FlushCommands_PreStep();     // 등록/부착 등
     ApplyFilterConfigIfDirty();  // dirty면 정책 갱신 + 전체 재적용 지시
     FlushDirtyColliders_PreStep(); //collider의 shape가 에디터 단계에서 변형되면 내부적으로 실행
@@ -49,28 +58,128 @@ void MMMEngine::PhysxManager::SetStep()
 
 void MMMEngine::PhysxManager::StepFixed(float dt)
 {
+    MMM_PROFILE_FUNCTION();
     if (!m_IsInitialized) return;
     if (dt <= 0.f) return;
 
+    // 한 프레임에 여러 스텝이 돌면 이전 스텝부터 마무리
+    SyncStep();
+
     m_PhysScene.PushRigidsToPhysics(); //등록된 rb목록을 순회하면서 pushtoPhysics를 호출
+
+    if (m_AsyncStep)
+    {
+        m_PhysScene.BeginStep(dt);  // simulate만 걸고 리턴, 나머지는 SyncStep
+        m_StepInFlight = m_PhysScene.IsSimulating();
+        return;
+    }
+
     m_PhysScene.Step(dt);       // simulate/fetch
+    m_StepInFlight = true;
+    SyncStep();
+}
+
+void MMMEngine::PhysxManager::SyncStep()
+{
+    if (!m_StepInFlight) return;
+    m_StepInFlight = false;
+    MMM_PROFILE_SCOPE("PhysxManager::SyncStep");
+
+    m_PhysScene.EndStep(true);             // fetchResults (비동기면 여기서 대기)
     m_PhysScene.PullRigidsFromPhysics();   // PhysX->엔진 읽기 (pose)
     m_PhysScene.DrainEvents();             // 이벤트 drain
 
+    ++m_StepIndex;
+    RecordSnapshot();
+
     DispatchPhysicsEvents();
 
     FlushCommands_PostStep();    // detach/unreg/release 등 후처리
 }
 
+void MMMEngine::PhysxManager::SetAsyncStep(bool value)
+{
+    if (m_AsyncStep == value) return;
+
+    // 모드 전환 전에 계산중인 스텝 정리
+    SyncStep();
+    m_AsyncStep = value;
+}
+
+void MMMEngine::PhysxManager::SetDeterministic(bool value)
+{
+    m_Deterministic = value;
+}
+
+void MMMEngine::PhysxManager::SetBroadPhase(physx::PxBroadPhaseType::Enum type, const physx::PxBounds3& worldBounds, uint32_t subdivisions)
+{
+    m_BroadPhaseType = type;
+    m_WorldBounds = worldBounds;
+    m_BroadPhaseSubdivisions = subdivisions;
+}
+
+void MMMEngine::PhysxManager::SetSnapshotHistory(uint32_t steps)
+{
+    m_SnapshotHistory = steps;
+    m_Snapshots.clear();
+    if (steps > 0)
+        m_Snapshots.resize(static_cast<size_t>(steps) + 1);
+}
+
+void MMMEngine::PhysxManager::RecordSnapshot()
+{
+    if (m_Snapshots.empty()) return;
+
+    // 슬롯 벡터를 재사용해서 매 스텝 할당 없음
+    auto& slot = m_Snapshots[m_StepIndex % m_Snapshots.size()];
+    slot.step = m_StepIndex;
+    m_PhysScene.CaptureRigidStates(slot.rigids);
+}
+
+bool MMMEngine::PhysxManager::RollbackSteps(uint32_t steps)
+{
+    if (!m_IsInitialized) return false;
+    SyncStep();
+
+    if (steps == 0) return true;
+    if (steps > m_SnapshotHistory || steps > m_StepIndex) return false;
+
+    const uint64_t target = m_StepIndex - steps;
+    const auto& slot = m_Snapshots[target % m_Snapshots.size()];
+    if (slot.step != target) return false; // 기록 전이거나 이미 덮어써짐
+
+    return LoadSnapshot(slot);
+}
+
+void MMMEngine::PhysxManager::SaveSnapshot(PhysicsSnapshot& out)
+{
+    SyncStep();
+    out.step = m_StepIndex;
+    m_PhysScene.CaptureRigidStates(out.rigids);
+}
+
+bool MMMEngine::PhysxManager::LoadSnapshot(const PhysicsSnapshot& snapshot)
+{
+    if (!m_IsInitialized) return false;
+    if (snapshot.step == UINT64_MAX) return false;
+    SyncStep();
+
+    m_PhysScene.RestoreRigidStates(snapshot.rigids);
+    m_StepIndex = snapshot.step;
+    return true;
+}
+
 void MMMEngine::PhysxManager::ApplyInterpolation(float alpha)
 {
     if (!m_IsInitialized) return;
+    SyncStep();
     m_PhysScene.ApplyInterpolation(alpha);
 }
 
 void MMMEngine::PhysxManager::SyncRigidsFromTransforms()
 {
     if (!m_IsInitialized) return;
+    SyncStep();
     m_PhysScene.SyncRigidsFromTransforms();
 }
 
@@ -135,8 +244,10 @@ void MMMEngine::PhysxManager::NotifyColliderRemoved(ColliderComponent* col)
     auto* rb = (RigidBodyComponent*)rbPtr.GetRaw();
 
     EraseCommandsForCollider(col);
-    m_DirtyColliders.erase(col);
-    m_FilterDirtyColliders.erase(col);
+    if (m_DirtyColliderSet.erase(col))
+        m_DirtyColliders.erase(std::remove(m_DirtyColliders.begin(), m_DirtyColliders.end(), col), m_DirtyColliders.end());
+    if (m_FilterDirtyColliderSet.erase(col))
+        m_FilterDirtyColliders.erase(std::remove(m_FilterDirtyColliders.begin(), m_FilterDirtyColliders.end(), col), m_FilterDirtyColliders.end());
     m_PendingDestroyCols.push_back(col);
 
     RequestDetachCollider(rb, col);
@@ -146,13 +257,18 @@ void MMMEngine::PhysxManager::NotifyColliderChanged(ColliderComponent* col)
 {
     if (!col) return;
 
-    if (col->IsGeometryDirty())
-        m_DirtyColliders.insert(col);
+    if (col->IsGeometryDirty() && m_DirtyColliderSet.insert(col).second)
+        m_DirtyColliders.push_back(col);
 
-    if (col->IsFilterDirty())
-        m_FilterDirtyColliders.insert(col);
+    if (col->IsFilterDirty() && m_FilterDirtyColliderSet.insert(col).second)
+        m_FilterDirtyColliders.push_back(col);
 }
 
+void MMMEngine::PhysxManager::NotifyColliderRebuild(ColliderComponent* col)
+{
+    if (!col) return;
+    RequestRebuildCollider(nullptr, col);
+}
 
 // rigidbody를 physScene 시뮬레이션 대상으로 등록한다
 void MMMEngine::PhysxManager::RequestRegisterRigid(MMMEngine::RigidBodyComponent* rb)
@@ -161,15 +277,9 @@ void MMMEngine::PhysxManager::RequestRegisterRigid(MMMEngine::RigidBodyComponent
     if (m_PendingUnreg.find(rb) != m_PendingUnreg.end()) return;
 
     // rb 관련 RegRigid 중복 제거 (혹은 rb 관련 명령 정리 정책에 맞게)
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
-    {
-        if (it->type == CmdType::RegRigid && it->new_rb == rb)
-            it = m_Commands.erase(it);
-        else
-            ++it;
-    }
+    CancelCommandsForRigid(rb, [](const Command& c) { return c.type == CmdType::RegRigid; });
 
-    m_Commands.push_back({ CmdType::RegRigid, rb, nullptr, nullptr});
+    PushCommand({ CmdType::RegRigid, rb, nullptr, nullptr});
 }
 
 // rigidbody가 가진 physX actor를 pxScene에서 제거 ( rigidbody를 더이상 물리월드에 존재하지 않게 만드는 함수 )
@@ -181,17 +291,11 @@ void MMMEngine::PhysxManager::RequestUnregisterRigid(MMMEngine::RigidBodyCompone
     if (m_PendingUnreg.find(rb) != m_PendingUnreg.end()) return;
 
     // 아직 처리 전인 Register/Attach/Detach 등을 정리(최소한 Reg/Attach는 제거 추천)
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
-    {
-        if (it->new_rb == rb)
-            it = m_Commands.erase(it);
-        else
-            ++it;
-    }
+    CancelCommandsForRigid(rb, [](const Command&) { return true; });
     //지울예정인 큐에 담음
     m_PendingUnreg.insert(rb);
     //큐에서 지운 rigid를 unregid type으로 바꿔서 physScene에서 actor를 빼도록 함
-    m_Commands.push_back({ CmdType::UnregRigid, rb, nullptr , nullptr});
+    PushCommand({ CmdType::UnregRigid, rb, nullptr , nullptr});
 }
 
 //collider를 physx로 만들고 만든 shape를 rigdbody에 attachShape함
@@ -203,15 +307,9 @@ void MMMEngine::PhysxManager::RequestAttachCollider(MMMEngine::RigidBodyComponen
         return;
     }
 
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
-    {
-        //DetachCol이 예약되어있다면 상쇄함
-        if (it->type == CmdType::DetachCol && it->new_rb == rb && it->col == col)
-            it = m_Commands.erase(it);
-        else
-            ++it;
-    }
-    m_Commands.push_back({ CmdType::AttachCol, rb, col , nullptr});
+    //DetachCol이 예약되어있다면 상쇄함
+    CancelCommandsForCollider(col, [rb](const Command& c) { return c.type == CmdType::DetachCol && c.new_rb == rb; });
+    PushCommand({ CmdType::AttachCol, rb, col , nullptr});
 }
 
 //rigid의 actor에서 해당 collider의 pxshape를 제거함
@@ -221,16 +319,10 @@ void MMMEngine::PhysxManager::RequestDetachCollider(MMMEngine::RigidBodyComponen
 
     if (m_PendingUnreg.find(rb) != m_PendingUnreg.end()) return;
     // 아직 처리 전인 Attach가 있으면 상쇄
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
-    {
-        if (it->type == CmdType::AttachCol && it->new_rb == rb && it->col == col)
-            it = m_Commands.erase(it);
-        else
-            ++it;
-    }
+    CancelCommandsForCollider(col, [rb](const Command& c) { return c.type == CmdType::AttachCol && c.new_rb == rb; });
 
     //attachcol했던 파일을 detach로 넣어서 제거
-    m_Commands.push_back({ CmdType::DetachCol, rb, col , nullptr});
+    PushCommand({ CmdType::DetachCol, rb, col , nullptr});
 }
 
 //collider의 shape를 다시 만들어서 원래 붙어있던 actor에 다시 붙인다 (collider쪽에 자기자신이 등록된 object확인 법필요 )
@@ -239,14 +331,8 @@ void MMMEngine::PhysxManager::RequestRebuildCollider(MMMEngine::RigidBodyCompone
     if (!col) return;
 
     //같은 col에 rebuil가 이미 있으면 중복 제거
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
-    {
-        if (it->type == CmdType::RebuildCol && it->col == col)
-            it = m_Commands.erase(it);
-        else
-            ++it;
-    }
-    m_Commands.push_back({ CmdType::RebuildCol, rb, col , nullptr});
+    CancelCommandsForCollider(col, [](const Command& c) { return c.type == CmdType::RebuildCol; });
+    PushCommand({ CmdType::RebuildCol, rb, col , nullptr});
 }
 
 //레이어/마스크 정책이 바뀌면 Scene에 존재하는 모든 shape의 filterdata를 다시 넣도록 지시
@@ -264,13 +350,7 @@ void MMMEngine::PhysxManager::RequestChangeRigidType(MMMEngine::RigidBodyCompone
         return;
 
     //같은 rb에 대한 이전 ChangeRigidType 요청이 있으면 제거 (마지막 요청만 남김)
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
-    {
-        if (it->type == CmdType::ChangeRigid && it->new_rb == rb)
-            it = m_Commands.erase(it);
-        else
-            ++it;
-    }
+    CancelCommandsForRigid(rb, [](const Command& c) { return c.type == CmdType::ChangeRigid; });
 
     // 정책: 타입 변경은 "actor 재생성"이라, 기존 Attach/Detach이 뒤섞이면 위험
     //    - 가장 안전한 정책은: 타입 변경 요청 시점에 rb 관련 Attach/Detach을 정리하거나
@@ -279,7 +359,7 @@ void MMMEngine::PhysxManager::RequestChangeRigidType(MMMEngine::RigidBodyCompone
     // 여기서는 "Flush 순서 강제"로 가는 게 보통 더 낫다.
     // 따라서 여기서는 지우지 않고, FlushCommands_PreStep에서 ChangeRigidType을 먼저 처리하게 만든다.
 
-    m_Commands.push_back({ CmdType::ChangeRigid, rb, nullptr , nullptr});
+    PushCommand({ CmdType::ChangeRigid, rb, nullptr , nullptr});
 }
 
 MMMEngine::RigidBodyComponent* MMMEngine::PhysxManager::GetOrCreateRigid(ObjPtr<GameObject> go)
@@ -339,7 +419,7 @@ void MMMEngine::PhysxManager::NotifyCompoundColliderAdded(ObjPtr<GameObject> nex
     for (auto* col : cols)
     {
         if (!col) continue;
-        m_Commands.push_back({ CmdType::TransferCol, newRoot, col, oldRoot });
+        PushCommand({ CmdType::TransferCol, newRoot, col, oldRoot });
     }
 }
 
@@ -386,45 +466,57 @@ void MMMEngine::PhysxManager::FlushCommands_PreStep()
     }
     m_PendingDestroyCols.clear();
     //ChangeRigidType 먼저 처리하도록
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    //처리 중 새 명령이 추가될 수 있으니 인덱스로 순회 (추가된 명령도 같은 패스에서 처리)
+    for (size_t i = 0; i < m_Commands.size(); ++i)
     {
-        if (it->type == CmdType::ChangeRigid)
-        {
-            m_PhysScene.ChangeRigidType(it->new_rb, m_CollisionMatrix);
-            it = m_Commands.erase(it);
-        }
-        else ++it;
+        if (!m_Commands[i].alive || m_Commands[i].type != CmdType::ChangeRigid) continue;
+
+        m_Commands[i].alive = false;
+        ++m_DeadCommands;
+        m_PhysScene.ChangeRigidType(m_Commands[i].new_rb, m_CollisionMatrix);
     }
 
 
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    for (size_t i = 0; i < m_Commands.size(); ++i)
     {
-        switch (it->type)
+        if (!m_Commands[i].alive) continue;
+
+        // 호출 중 벡터가 재할당될 수 있으니 복사본 사용
+        const Command cmd = m_Commands[i];
+        switch (cmd.type)
         {
         case CmdType::RegRigid:
-            m_PhysScene.RegisterRigid(it->new_rb);
-            it = m_Commands.erase(it);
+        case CmdType::AttachCol:
+        case CmdType::RebuildCol:
+        case CmdType::TransferCol:
+            m_Commands[i].alive = false;
+            ++m_DeadCommands;
             break;
+        default:
+            // Post에서 처리할 타입(Detach/Unreg)은 남겨둔다
+            continue;
+        }
 
+        switch (cmd.type)
+        {
+        case CmdType::RegRigid:
+            m_PhysScene.RegisterRigid(cmd.new_rb);
+            break;
         case CmdType::AttachCol:
-            m_PhysScene.AttachCollider(it->new_rb, it->col, m_CollisionMatrix);
-            it = m_Commands.erase(it);
+            m_PhysScene.AttachCollider(cmd.new_rb, cmd.col, m_CollisionMatrix);
             break;
-
         case CmdType::RebuildCol:
-            m_PhysScene.RebuildCollider(it->col, m_CollisionMatrix);
-            it = m_Commands.erase(it);
+            m_PhysScene.RebuildCollider(cmd.col, m_CollisionMatrix);
             break;
         case CmdType::TransferCol:
-            m_PhysScene.TransferCollider(it->cur_rb, it->new_rb, it->col, m_CollisionMatrix);
-            it = m_Commands.erase(it);
+            m_PhysScene.TransferCollider(cmd.cur_rb, cmd.new_rb, cmd.col, m_CollisionMatrix);
             break;
         default:
-            // Post에서 처리할 타입(Detach/Unreg)은 남겨둔다
-            ++it;
             break;
         }
     }
+
+    CompactCommands();
 }
 
 
@@ -432,57 +524,42 @@ void MMMEngine::PhysxManager::FlushCommands_PreStep()
 void MMMEngine::PhysxManager::FlushCommands_PostStep()
 {
     //Detach
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    for (size_t i = 0; i < m_Commands.size(); ++i)
     {
-        if (it->type == CmdType::DetachCol)
-        {
-            auto* rb = it->new_rb;
-            auto* col = it->col;
+        if (!m_Commands[i].alive || m_Commands[i].type != CmdType::DetachCol) continue;
 
-            // rb가 곧 Unregister 될 예정이면 Detach는 의미 없거나 위험할 수 있음
-            if (!rb || m_PendingUnreg.find(rb) != m_PendingUnreg.end())
-            {
-                it = m_Commands.erase(it);
-                continue;
-            }
+        const Command cmd = m_Commands[i];
+        m_Commands[i].alive = false;
+        ++m_DeadCommands;
 
-            // actor가 이미 없으면 detach할 것도 없음 (안전)
-            if (rb->GetPxActor() == nullptr)
-            {
-                it = m_Commands.erase(it);
-                continue;
-            }
+        // rb가 곧 Unregister 될 예정이면 Detach는 의미 없거나 위험할 수 있음
+        if (!cmd.new_rb || m_PendingUnreg.find(cmd.new_rb) != m_PendingUnreg.end())
+            continue;
 
-            m_PhysScene.DetachCollider(rb, col);
-            it = m_Commands.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        // actor가 이미 없으면 detach할 것도 없음 (안전)
+        if (cmd.new_rb->GetPxActor() == nullptr)
+            continue;
+
+        m_PhysScene.DetachCollider(cmd.new_rb, cmd.col);
     }
 
     // Unregister
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    for (size_t i = 0; i < m_Commands.size(); ++i)
     {
-        if (it->type == CmdType::UnregRigid)
-        {
-            auto* rb = it->new_rb;
+        if (!m_Commands[i].alive || m_Commands[i].type != CmdType::UnregRigid) continue;
 
-            if (rb)
-            {
-                m_PhysScene.UnregisterRigid(rb); // 내부에서 actor 존재 체크 + destroy idempotent면 안정
-                m_PendingUnreg.erase(rb);
-            }
+        auto* rb = m_Commands[i].new_rb;
+        m_Commands[i].alive = false;
+        ++m_DeadCommands;
 
-            it = m_Commands.erase(it);
-        }
-        else
+        if (rb)
         {
-            ++it;
+            m_PhysScene.UnregisterRigid(rb); // 내부에서 actor 존재 체크 + destroy idempotent면 안정
+            m_PendingUnreg.erase(rb);
         }
     }
 
+    CompactCommands();
 }
 
 //충돌 매트릭스 설정이 바뀌엇는지 확인하고 바뀌었으면 scene에 등록된 shape에 새필터를 모두 적용시키는 함수
@@ -512,6 +589,7 @@ void MMMEngine::PhysxManager::FlushDirtyColliders_PreStep()
         m_PhysScene.UpdateColliderGeometry(col);
     }
     m_DirtyColliders.clear();
+    m_DirtyColliderSet.clear();
 }
 
 void MMMEngine::PhysxManager::FlushDirtyColliderFilters_PreStep()
@@ -533,48 +611,106 @@ void MMMEngine::PhysxManager::FlushDirtyColliderFilters_PreStep()
         col->ClearFilterDirty();
     }
     m_FilterDirtyColliders.clear();
+    m_FilterDirtyColliderSet.clear();
 }
 
 
 
-void MMMEngine::PhysxManager::EraseCommandsForRigid(MMMEngine::RigidBodyComponent* rb)
+void MMMEngine::PhysxManager::PushCommand(const Command& cmd)
 {
-    if (!rb) return;
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    const size_t index = m_Commands.size();
+    m_Commands.push_back(cmd);
+
+    if (cmd.new_rb) m_CmdsByRigid[cmd.new_rb].push_back(index);
+    if (cmd.col) m_CmdsByCollider[cmd.col].push_back(index);
+}
+
+template<typename Pred>
+void MMMEngine::PhysxManager::CancelCommandsForRigid(MMMEngine::RigidBodyComponent* rb, Pred pred)
+{
+    auto it = m_CmdsByRigid.find(rb);
+    if (it == m_CmdsByRigid.end()) return;
+
+    for (size_t index : it->second)
     {
-        if (it->new_rb == rb) it = m_Commands.erase(it);
-        else ++it;
+        Command& cmd = m_Commands[index];
+        if (!cmd.alive || cmd.new_rb != rb || !pred(cmd)) continue;
+        cmd.alive = false;
+        ++m_DeadCommands;
     }
 }
 
-void MMMEngine::PhysxManager::EraseAttachDetachForRigid(MMMEngine::RigidBodyComponent* rb)
+template<typename Pred>
+void MMMEngine::PhysxManager::CancelCommandsForCollider(MMMEngine::ColliderComponent* col, Pred pred)
 {
-    if (!rb) return;
+    auto it = m_CmdsByCollider.find(col);
+    if (it == m_CmdsByCollider.end()) return;
 
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    for (size_t index : it->second)
     {
-        if ((it->new_rb == rb) &&
-            (it->type == CmdType::AttachCol || it->type == CmdType::DetachCol))
-            it = m_Commands.erase(it);
-        else
-            ++it;
+        Command& cmd = m_Commands[index];
+        if (!cmd.alive || cmd.col != col || !pred(cmd)) continue;
+        cmd.alive = false;
+        ++m_DeadCommands;
     }
 }
 
-void MMMEngine::PhysxManager::EraseCommandsForCollider(MMMEngine::ColliderComponent* col)
+void MMMEngine::PhysxManager::CompactCommands()
 {
-    if (!col) return;
+    if (m_DeadCommands == 0) return;
+
+    // 살아있는 명령만 순서 유지해서 앞으로 당김
+    size_t write = 0;
+    for (size_t read = 0; read < m_Commands.size(); ++read)
+    {
+        if (!m_Commands[read].alive) continue;
+        if (write != read) m_Commands[write] = m_Commands[read];
+        ++write;
+    }
+    m_Commands.resize(write);
+    m_DeadCommands = 0;
 
-    for (auto it = m_Commands.begin(); it != m_Commands.end(); )
+    m_CmdsByRigid.clear();
+    m_CmdsByCollider.clear();
+    for (size_t i = 0; i < m_Commands.size(); ++i)
     {
-        if (it->col == col &&
-            (it->type == CmdType::AttachCol || it->type == CmdType::DetachCol || it->type == CmdType::RebuildCol))
-            it = m_Commands.erase(it);
-        else
-            ++it;
+        if (m_Commands[i].new_rb) m_CmdsByRigid[m_Commands[i].new_rb].push_back(i);
+        if (m_Commands[i].col) m_CmdsByCollider[m_Commands[i].col].push_back(i);
     }
 }
 
+void MMMEngine::PhysxManager::ClearCommands()
+{
+    m_Commands.clear();
+    m_CmdsByRigid.clear();
+    m_CmdsByCollider.clear();
+    m_DeadCommands = 0;
+}
+
+void MMMEngine::PhysxManager::EraseCommandsForRigid(MMMEngine::RigidBodyComponent* rb)
+{
+    if (!rb) return;
+    CancelCommandsForRigid(rb, [](const Command&) { return true; });
+}
+
+void MMMEngine::PhysxManager::EraseAttachDetachForRigid(MMMEngine::RigidBodyComponent* rb)
+{
+    if (!rb) return;
+    CancelCommandsForRigid(rb, [](const Command& c)
+        {
+            return c.type == CmdType::AttachCol || c.type == CmdType::DetachCol;
+        });
+}
+
+void MMMEngine::PhysxManager::EraseCommandsForCollider(MMMEngine::ColliderComponent* col)
+{
+    if (!col) return;
+    CancelCommandsForCollider(col, [](const Command& c)
+        {
+            return c.type == CmdType::AttachCol || c.type == CmdType::DetachCol || c.type == CmdType::RebuildCol;
+        });
+}
+
 void MMMEngine::PhysxManager::NotifyRigidTypeChanged(RigidBodyComponent* rb)
 {
     if (!rb) return;
@@ -583,9 +719,27 @@ void MMMEngine::PhysxManager::NotifyRigidTypeChanged(RigidBodyComponent* rb)
 
 void MMMEngine::PhysxManager::UnbindScene()
 {
-    m_Commands.clear();
+    // 계산중인 스텝은 결과 반영 없이 종료만 기다림
+    if (m_StepInFlight)
+    {
+        m_PhysScene.EndStep(true);
+        m_StepInFlight = false;
+    }
+
+    ClearCommands();
     m_DirtyColliders.clear();
+    m_DirtyColliderSet.clear();
+    m_FilterDirtyColliders.clear();
+    m_FilterDirtyColliderSet.clear();
     m_PendingUnreg.clear();
+
+    // 스텝 번호/스냅샷은 씬 단위
+    m_StepIndex = 0;
+    for (auto& snapshot : m_Snapshots)
+    {
+        snapshot.step = UINT64_MAX;
+        snapshot.rigids.clear();
+    }
     m_FilterDirty = false;
 
     if (m_IsInitialized)
@@ -628,10 +782,11 @@ void MMMEngine::PhysxManager::DispatchPhysicsEvents()
         const Vector3 p = ToVec(e.point);
         const float depth = e.penetrationDepth;
 
+        // 큐 안에서 바로 생성 (임시 객체 복사 없음)
         auto PushCollisionBoth = [&](CollisionPhase phase)
             {
                 // A -> B
-                CollisionInfo infoA;
+                CollisionInfo& infoA = std::get<CollisionInfo>(Callback_Que.emplace_back(std::in_place_type<CollisionInfo>));
                 infoA.self = goA;
                 infoA.other = goB;
                 infoA.selfCollider = colA;
@@ -640,10 +795,9 @@ void MMMEngine::PhysxManager::DispatchPhysicsEvents()
                 infoA.point = p;
                 infoA.penetrationDepth = depth;
                 infoA.phase = phase;
-                Callback_Que.emplace_back(infoA);
 
                 // B -> A (normal 반전)
-                CollisionInfo infoB;
+                CollisionInfo& infoB = std::get<CollisionInfo>(Callback_Que.emplace_back(std::in_place_type<CollisionInfo>));
                 infoB.self = goB;
                 infoB.other = goA;
                 infoB.selfCollider = colB;
@@ -652,7 +806,6 @@ void MMMEngine::PhysxManager::DispatchPhysicsEvents()
                 infoB.point = p;
                 infoB.penetrationDepth = depth;
                 infoB.phase = phase;
-                Callback_Que.emplace_back(infoB);
             };
 
         if (enter) PushCollisionBoth(CollisionPhase::Enter);
@@ -676,24 +829,91 @@ void MMMEngine::PhysxManager::DispatchPhysicsEvents()
         const TriggerPhase phase = t.isEnter ? TriggerPhase::Enter : TriggerPhase::Exit;
 
         // 트리거도 양쪽에 이벤트를 주고 싶으면 2개 push
-        TriggerInfo infoT;
+        TriggerInfo& infoT = std::get<TriggerInfo>(Callback_Que.emplace_back(std::in_place_type<TriggerInfo>));
         infoT.self = goT;
         infoT.other = goO;
         infoT.selfCollider = triggerCol;
         infoT.otherCollider = otherCol;
         infoT.phase = phase;
-        Callback_Que.emplace_back(infoT);
 
-        TriggerInfo infoO;
+        TriggerInfo& infoO = std::get<TriggerInfo>(Callback_Que.emplace_back(std::in_place_type<TriggerInfo>));
         infoO.self = goO;
         infoO.other = goT;
         infoO.selfCollider = otherCol;
         infoO.otherCollider = triggerCol;
         infoO.phase = phase;
-        Callback_Que.emplace_back(infoO);
     }
 }
 
+std::vector<std::variant<MMMEngine::CollisionInfo, MMMEngine::TriggerInfo>>& MMMEngine::PhysxManager::TakeCallbackQue()
+{
+    m_DispatchQue.clear();
+    std::swap(m_DispatchQue, Callback_Que);
+    return m_DispatchQue;
+}
+
+void MMMEngine::PhysxManager::DispatchScriptCallbacks()
+{
+    auto& vec = TakeCallbackQue();
+
+    for (auto& ev : vec)
+    {
+        //기존은 enum으로 switch 분기, variant를 쓰면서 실제타입분리를 위해 visit를 사용
+        //variant 안에 들어 있는 실제 타입에 따라 함수를 호출
+        std::visit([&](auto& e)
+            {
+                using T = std::decay_t<decltype(e)>;
+
+                if constexpr (std::is_same_v<T, CollisionInfo>)
+                {
+                    switch (e.phase)
+                    {
+                    case CollisionPhase::Enter:
+                        BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionEnter", e);
+                        break;
+                    case CollisionPhase::Stay:
+                        BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionStay", e);
+                        break;
+                    case CollisionPhase::Exit:
+                        BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnCollisionExit", e);
+                        break;
+                    }
+                }
+                else if constexpr (std::is_same_v<T, TriggerInfo>)
+                {
+                    switch (e.phase)
+                    {
+                    case TriggerPhase::Enter:
+                        BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnTriggerEnter", e);
+                        break;
+                    case TriggerPhase::Exit:
+                        BehaviourManager::Get().SpecificBroadCastBehaviourMessage(e.self, "OnTriggerExit", e);
+                        break;
+                    }
+                }
+            }, ev);
+    }
+}
+
+void MMMEngine::PhysxManager::RunFixedStep(float dt)
+{
+    // 비동기 모드에서는 SetStep 이 직전 스텝을 동기화하므로 그 이벤트를 FixedUpdate 전에 보냄
+    SetStep();
+    DispatchScriptCallbacks();
+
+    BehaviourManager::Get().BroadCastBehaviourMessage("FixedUpdate");
+    StepFixed(dt);
+
+    // 동기 모드는 여기서 이번 스텝 이벤트가 나감
+    DispatchScriptCallbacks();
+}
+
+void MMMEngine::PhysxManager::SyncStepAndDispatch()
+{
+    SyncStep();
+    DispatchScriptCallbacks();
+}
+
 void MMMEngine::PhysxManager::Shutdown()
 {
     UnbindScene();
@@ -733,3 +953,198 @@ MMMEngine::RigidBodyComponent* MMMEngine::PhysxManager::FindHighestRigid(ObjPtr<
     }
     return last;
 }
+
+
+namespace
+{
+    // 쿼리 형상 -> PhysX geometry
+    physx::PxGeometryHolder ToPxQueryGeometry(const MMMEngine::QueryShape& shape)
+    {
+        switch (shape.type)
+        {
+        case MMMEngine::QueryShape::Type::Box:
+            return physx::PxGeometryHolder(physx::PxBoxGeometry(ToPxVec(shape.halfExtents)));
+        case MMMEngine::QueryShape::Type::Capsule:
+            return physx::PxGeometryHolder(physx::PxCapsuleGeometry(shape.radius, shape.halfHeight));
+        case MMMEngine::QueryShape::Type::Sphere:
+        default:
+            return physx::PxGeometryHolder(physx::PxSphereGeometry(shape.radius));
+        }
+    }
+
+    physx::PxTransform ToPxQueryPose(const MMMEngine::QueryShape& shape, const Vector3& position, const Quaternion& rotation)
+    {
+        physx::PxTransform pose = ToPxTrans(position, rotation);
+
+        // PhysX 캡슐은 x축 기준이라 콜라이더와 같은 축 보정 (y축 기준으로)
+        if (shape.type == MMMEngine::QueryShape::Type::Capsule)
+            pose.q = pose.q * physx::PxQuat(physx::PxHalfPi, physx::PxVec3(0.f, 0.f, 1.f));
+        return pose;
+    }
+
+    // 방향 정규화 //길이가 0이면 쿼리 불가
+    bool ToPxQueryDir(const Vector3& direction, physx::PxVec3& outDir)
+    {
+        outDir = ToPxVec(direction);
+        const float len = outDir.magnitude();
+        if (len <= 1e-6f) return false;
+        outDir /= len;
+        return true;
+    }
+
+    void FillQueryHit(const physx::PxLocationHit& px, physx::PxShape* shape, MMMEngine::QueryHit& out)
+    {
+        out.collider = MMMEngine::ObjectManager::Get().GetPtrFromRaw<MMMEngine::ColliderComponent>(shape ? shape->userData : nullptr);
+        out.gameObject = out.collider.IsValid() ? out.collider->GetGameObject() : MMMEngine::ObjPtr<MMMEngine::GameObject>();
+        out.point = ToVec(px.position);
+        out.normal = ToVec(px.normal);
+        out.distance = px.distance;
+    }
+
+    // 배치 쿼리 청크 최소 크기
+    constexpr size_t kQueryMinPerChunk = 64;
+}
+
+uint32_t MMMEngine::PhysxManager::GetQueryMaskForLayer(uint32_t layer) const
+{
+    return m_CollisionMatrix.MakeQueryFilter(layer).word1;
+}
+
+bool MMMEngine::PhysxManager::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, QueryHit& outHit, uint32_t layerMask)
+{
+    outHit = QueryHit{};
+    if (layerMask == 0) return false;
+
+    physx::PxVec3 dir;
+    if (!ToPxQueryDir(direction, dir) || maxDistance <= 0.0f) return false;
+
+    physx::PxRaycastHit hit;
+    if (!m_PhysScene.Raycast(ToPxVec(origin), dir, maxDistance, layerMask, hit))
+        return false;
+
+    FillQueryHit(hit, hit.shape, outHit);
+    return outHit.collider.IsValid();
+}
+
+bool MMMEngine::PhysxManager::Sweep(const QueryShape& shape, const Vector3& origin, const Quaternion& rotation, const Vector3& direction, float maxDistance, QueryHit& outHit, uint32_t layerMask)
+{
+    outHit = QueryHit{};
+    if (layerMask == 0) return false;
+
+    physx::PxVec3 dir;
+    if (!ToPxQueryDir(direction, dir) || maxDistance <= 0.0f) return false;
+
+    const physx::PxGeometryHolder geom = ToPxQueryGeometry(shape);
+    physx::PxSweepHit hit;
+    if (!m_PhysScene.Sweep(geom.any(), ToPxQueryPose(shape, origin, rotation), dir, maxDistance, layerMask, hit))
+        return false;
+
+    FillQueryHit(hit, hit.shape, outHit);
+    return outHit.collider.IsValid();
+}
+
+size_t MMMEngine::PhysxManager::Overlap(const QueryShape& shape, const Vector3& position, const Quaternion& rotation, std::vector<ObjPtr<ColliderComponent>>& outColliders, uint32_t layerMask)
+{
+    outColliders.clear();
+    if (layerMask == 0) return 0;
+
+    physx::PxOverlapHit hits[kMaxOverlapHits];
+    const physx::PxGeometryHolder geom = ToPxQueryGeometry(shape);
+    const physx::PxU32 count = m_PhysScene.Overlap(geom.any(), ToPxQueryPose(shape, position, rotation), layerMask, hits, kMaxOverlapHits);
+
+    for (physx::PxU32 i = 0; i < count; ++i)
+    {
+        auto col = ObjectManager::Get().GetPtrFromRaw<ColliderComponent>(hits[i].shape ? hits[i].shape->userData : nullptr);
+        if (col.IsValid()) outColliders.push_back(col);
+    }
+    return outColliders.size();
+}
+
+void MMMEngine::PhysxManager::RaycastBatch(const std::vector<RaycastQuery>& queries, std::vector<QueryHit>& outHits)
+{
+    const size_t count = queries.size();
+    outHits.assign(count, QueryHit{});
+    m_RaycastScratch.resize(count);
+    m_QueryHasHit.assign(count, 0);
+
+    // 1) PhysX 쿼리만 워커에서 (각 쿼리는 자기 index에만 씀)
+    JobSystem::Get().ParallelFor(count, kQueryMinPerChunk, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const RaycastQuery& q = queries[i];
+                physx::PxVec3 dir;
+                if (!ToPxQueryDir(q.direction, dir) || q.maxDistance <= 0.0f) continue;
+
+                m_QueryHasHit[i] = m_PhysScene.Raycast(ToPxVec(q.origin), dir, q.maxDistance, q.layerMask, m_RaycastScratch[i]) ? 1 : 0;
+            }
+        });
+
+    // 2) ObjPtr 변환은 메인 스레드에서
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (m_QueryHasHit[i]) FillQueryHit(m_RaycastScratch[i], m_RaycastScratch[i].shape, outHits[i]);
+    }
+}
+
+void MMMEngine::PhysxManager::SweepBatch(const std::vector<SweepQuery>& queries, std::vector<QueryHit>& outHits)
+{
+    const size_t count = queries.size();
+    outHits.assign(count, QueryHit{});
+    m_SweepScratch.resize(count);
+    m_QueryHasHit.assign(count, 0);
+
+    JobSystem::Get().ParallelFor(count, kQueryMinPerChunk, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const SweepQuery& q = queries[i];
+                physx::PxVec3 dir;
+                if (!ToPxQueryDir(q.direction, dir) || q.maxDistance <= 0.0f) continue;
+
+                const physx::PxGeometryHolder geom = ToPxQueryGeometry(q.shape);
+                m_QueryHasHit[i] = m_PhysScene.Sweep(geom.any(), ToPxQueryPose(q.shape, q.origin, q.rotation), dir, q.maxDistance, q.layerMask, m_SweepScratch[i]) ? 1 : 0;
+            }
+        });
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (m_QueryHasHit[i]) FillQueryHit(m_SweepScratch[i], m_SweepScratch[i].shape, outHits[i]);
+    }
+}
+
+void MMMEngine::PhysxManager::OverlapBatch(const std::vector<OverlapQuery>& queries, std::vector<std::vector<ObjPtr<ColliderComponent>>>& outColliders)
+{
+    const size_t count = queries.size();
+    outColliders.resize(count);
+    for (auto& list : outColliders) list.clear();
+
+    // 청크마다 결과를 따로 모음 (청크는 연속 구간이라 병합하면 쿼리 순서 유지)
+    m_OverlapScratch.resize(JobSystem::Get().GetChunkCount());
+    for (auto& chunk : m_OverlapScratch) chunk.clear();
+
+    JobSystem::Get().ParallelFor(count, kQueryMinPerChunk, [&](size_t begin, size_t end, size_t chunkIndex)
+        {
+            auto& chunk = m_OverlapScratch[chunkIndex];
+            physx::PxOverlapHit hits[kMaxOverlapHits];
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const OverlapQuery& q = queries[i];
+                const physx::PxGeometryHolder geom = ToPxQueryGeometry(q.shape);
+                const physx::PxU32 hitCount = m_PhysScene.Overlap(geom.any(), ToPxQueryPose(q.shape, q.position, q.rotation), q.layerMask, hits, kMaxOverlapHits);
+
+                for (physx::PxU32 h = 0; h < hitCount; ++h)
+                    chunk.emplace_back(i, hits[h].shape);
+            }
+        });
+
+    for (const auto& chunk : m_OverlapScratch)
+    {
+        for (const auto& [queryIndex, shape] : chunk)
+        {
+            auto col = ObjectManager::Get().GetPtrFromRaw<ColliderComponent>(shape ? shape->userData : nullptr);
+            if (col.IsValid()) outColliders[queryIndex].push_back(col);
+        }
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <variant>
+#include <unordered_map>
 
 
 
@@ -49,6 +50,65 @@ namespace MMMEngine
 		TriggerPhase phase = TriggerPhase::Enter;
 	};
 
+	// 씬 쿼리용 형상 (캡슐은 엔진 콜라이더와 같이 y축 기준)
+	struct MMMENGINE_API QueryShape
+	{
+		enum class Type { Sphere, Box, Capsule };
+
+		Type type = Type::Sphere;
+		Vector3 halfExtents = { 0.5f, 0.5f, 0.5f };	// Box
+		float radius = 0.5f;							// Sphere, Capsule
+		float halfHeight = 0.5f;						// Capsule
+
+		static QueryShape Sphere(float _radius) { QueryShape s; s.type = Type::Sphere; s.radius = _radius; return s; }
+		static QueryShape Box(const Vector3& _halfExtents) { QueryShape s; s.type = Type::Box; s.halfExtents = _halfExtents; return s; }
+		static QueryShape Capsule(float _radius, float _halfHeight) { QueryShape s; s.type = Type::Capsule; s.radius = _radius; s.halfHeight = _halfHeight; return s; }
+	};
+
+	// Raycast / Sweep 결과 (맞은게 없으면 collider가 nullptr)
+	struct MMMENGINE_API QueryHit
+	{
+		ObjPtr<ColliderComponent> collider = nullptr;
+		ObjPtr<GameObject> gameObject;
+
+		Vector3 point;
+		Vector3 normal;
+		float distance = 0.0f;
+	};
+
+	struct MMMENGINE_API RaycastQuery
+	{
+		Vector3 origin;
+		Vector3 direction;
+		float maxDistance = PX_MAX_F32;
+		uint32_t layerMask = 0xFFFFFFFFu;
+	};
+
+	struct MMMENGINE_API SweepQuery
+	{
+		QueryShape shape;
+		Vector3 origin;
+		Quaternion rotation = Quaternion::Identity;
+		Vector3 direction;
+		float maxDistance = PX_MAX_F32;
+		uint32_t layerMask = 0xFFFFFFFFu;
+	};
+
+	struct MMMENGINE_API OverlapQuery
+	{
+		QueryShape shape;
+		Vector3 position;
+		Quaternion rotation = Quaternion::Identity;
+		uint32_t layerMask = 0xFFFFFFFFu;
+	};
+
+	// 롤백용 물리 상태 (step : 이 상태까지 진행된 fixed step 수)
+	struct MMMENGINE_API PhysicsSnapshot
+	{
+		uint64_t step = UINT64_MAX;
+		std::vector<PhysScene::RigidStateEntry> rigids;
+	};
+
 	class MMMENGINE_API PhysxManager : public Utility::ExportSingleton<PhysxManager>
 	{
 	public:
@@ -60,8 +120,61 @@ namespace MMMEngine
 
 		// fixed step에서 호출되는 진입점
 		void StepFixed(float dt);
+
+		// 비동기 스텝 모드
+		// StepFixed는 push + simulate만 걸고 리턴, 결과(pose pull, 이벤트, 후처리)는 SyncStep에서 반영
+		// 동기화 지점 : SyncStep 직접 호출, 다음 SetStep/StepFixed, ApplyInterpolation, SyncRigidsFromTransforms, UnbindScene
+		// 계산중(Update/LateUpdate 등)에 스크립트가 지켜야 할 것
+		//  - AddForce/Teleport/Set*Velocity 등 rigid 조작은 가능 (다음 스텝에 반영)
+		//  - Get*Velocity, Px_Get* 는 직전 스텝 결과를 반환
+		//  - rigid가 붙은 오브젝트의 Transform은 동기화 지점에서 물리 결과로 덮어써짐
+		//  - 콜라이더/리지드 추가 제거는 기존처럼 큐에 쌓였다가 다음 SetStep에서 처리
+		// 충돌/트리거 콜백 순서 : 한 프레임에 스텝이 여러 번이면 SetStep 에서 걷힌 직전 스텝 이벤트를
+		//  다음 FixedUpdate 전에 디스패치해야 동기 모드와 같은 순서가 됨 (마지막 스텝은 SyncStep 후 디스패치)
+		//  호스트(플레이어/에디터)는 이 순서를 직접 맞추지 말고 RunFixedStep / SyncStepAndDispatch 를 호출
+		void SetAsyncStep(bool value);
+		bool IsAsyncStep() const { return m_AsyncStep; }
+		bool IsStepInFlight() const { return m_StepInFlight; }
+		void SyncStep();
+
+		// 고정 스텝 하나 (ConsumeFixedSteps 콜백에서 호출)
+		// SetStep -> 직전 스텝 콜백 디스패치 -> FixedUpdate -> StepFixed -> (동기 모드면) 이번 스텝 콜백 디스패치
+		void RunFixedStep(float dt);
+		// 프레임 끝 동기화 지점 (LateUpdate 이후) : SyncStep 후 마지막 스텝 콜백 디스패치
+		void SyncStepAndDispatch();
+		// 쌓인 충돌/트리거 이벤트를 스크립트 메시지(OnCollision*/OnTrigger*)로 전달
+		void DispatchScriptCallbacks();
 		void ApplyInterpolation(float alpha);
+
+		// 결정론 모드 (리플레이/네트워크)
+		// PhysX enhanced determinism 플래그로 씬을 생성함 //씬 생성 시점에만 설정 가능해서 다음 BindScene부터 반영
+		// rigid/dirty 콜라이더 처리 순서는 모드와 상관없이 등록 순서로 고정되어 있음
+		// 프레임당 스텝 수까지 고정하려면 TimeManager::SetDeterministic도 같이 켜야 함
+		void SetDeterministic(bool value);
+		bool IsDeterministic() const { return m_Deterministic; }
+
+		// 브로드페이즈 설정 (PhysicsSettings에서 적용) //씬 생성 시점에 정해져서 다음 BindScene부터 반영
+		void SetBroadPhase(physx::PxBroadPhaseType::Enum type, const physx::PxBounds3& worldBounds, uint32_t subdivisions);
+
+		// 동기 스텝을 collide/advance로 나눠 단계별 시간 측정 (벤치마크/프로파일링용)
+		void SetStepProfiling(bool value) { m_PhysScene.SetStepProfiling(value); }
+		const PhysStepStats& GetStepStats() const { return m_PhysScene.GetStepStats(); }
+
+		// 롤백
+		// SetSnapshotHistory(n) : 매 스텝 결과 반영 직후 rigid 상태를 최근 n 스텝만큼 메모리에 보관 (0이면 보관 안함)
+		// RollbackSteps(k) : k 스텝 전 상태로 되돌림 -> 입력을 다시 넣고 StepFixed를 k번 호출해서 재시뮬레이션
+		// 이미 디스패치된 충돌 이벤트는 되돌리지 않음, PhysX 내부 접촉 캐시는 스냅샷에 포함되지 않음
+		void SetSnapshotHistory(uint32_t steps);
+		uint32_t GetSnapshotHistory() const { return m_SnapshotHistory; }
+		uint64_t GetStepIndex() const { return m_StepIndex; }
+		bool RollbackSteps(uint32_t steps);
+		void SaveSnapshot(PhysicsSnapshot& out);
+		bool LoadSnapshot(const PhysicsSnapshot& snapshot);
 		void SyncRigidsFromTransforms();
+		//직전 SyncRigidsFromTransforms에서 Transform이 바뀌어서 반영된 rigid 수
+		uint32_t GetLastSyncedRigidCount() const { return m_PhysScene.GetLastSyncedRigidCount(); }
+		//직전 스텝에서 drain된 contact 이벤트 수
+		size_t GetLastContactCount() const { return m_PhysScene.GetFrameContacts().size(); }
 
 		//외부 노출함수
 		void NotifyRigidAdded(RigidBodyComponent* rb);
@@ -73,6 +186,9 @@ namespace MMMEngine
 		// 값 변경 
 		void NotifyColliderChanged(ColliderComponent* col);
 
+		// shape 자체를 다시 만들어야 할때 (geometry 타입 변경 등) //다음 SetStep에서 BuildShape + 재부착
+		void NotifyColliderRebuild(ColliderComponent* col);
+
 		// 타입 변경
 		void NotifyRigidTypeChanged(RigidBodyComponent* rb);
 
@@ -89,7 +205,29 @@ namespace MMMEngine
 
 		void SetLayerCollision(uint32_t layerA, uint32_t layerB, bool canCollide);
 
+		//씬 쿼리
+		//layerMask : 검사할 레이어 비트 마스크 //GetQueryMaskForLayer로 CollisionMatrix 기준 마스크를 얻을 수 있음
+		//  0이면 (아무 레이어와도 충돌하지 않는 레이어의 마스크 포함) 항상 결과 없음
+		//Scene Query가 켜진 콜라이더만 대상 (트리거/Disabled는 제외)
+		static constexpr uint32_t kAllLayers = 0xFFFFFFFFu;
+		static constexpr uint32_t kMaxOverlapHits = 256;
+
+		//해당 레이어가 충돌하는 레이어들의 마스크
+		uint32_t GetQueryMaskForLayer(uint32_t layer) const;
+
+		bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, QueryHit& outHit, uint32_t layerMask = kAllLayers);
+		bool Sweep(const QueryShape& shape, const Vector3& origin, const Quaternion& rotation, const Vector3& direction, float maxDistance, QueryHit& outHit, uint32_t layerMask = kAllLayers);
+		size_t Overlap(const QueryShape& shape, const Vector3& position, const Quaternion& rotation, std::vector<ObjPtr<ColliderComponent>>& outColliders, uint32_t layerMask = kAllLayers);
+
+		//배치 쿼리 //PhysX 쿼리는 JobSystem 워커에서 병렬로 돌고, ObjPtr 변환은 메인 스레드에서 쿼리 순서대로 함
+		//outHits[i] 는 queries[i] 결과
+		void RaycastBatch(const std::vector<RaycastQuery>& queries, std::vector<QueryHit>& outHits);
+		void SweepBatch(const std::vector<SweepQuery>& queries, std::vector<QueryHit>& outHits);
+		void OverlapBatch(const std::vector<OverlapQuery>& queries, std::vector<std::vector<ObjPtr<ColliderComponent>>>& outColliders);
+
 		std::vector<std::variant<CollisionInfo, TriggerInfo>>& GetCallbackQue() { return Callback_Que; }
+		//쌓인 이벤트 큐를 넘겨받음 (더블 버퍼) //반환된 큐는 다음 TakeCallbackQue 호출 전까지 유효
+		std::vector<std::variant<CollisionInfo, TriggerInfo>>& TakeCallbackQue();
 
 		std::vector<ColliderComponent*> m_PendingDestroyCols;
 
@@ -129,6 +267,14 @@ namespace MMMEngine
 		//이벤트보관함수
 		//std::vector<std::tuple<ObjPtr<GameObject>, ObjPtr<GameObject>, P_EvenType>> Callback_Que;
 		std::vector<std::variant<CollisionInfo, TriggerInfo>> Callback_Que;
+		//디스패치중인 큐 (Callback_Que와 교대로 사용해서 매 프레임 재할당 없음)
+		std::vector<std::variant<CollisionInfo, TriggerInfo>> m_DispatchQue;
+
+		//배치 쿼리 워커 결과 보관용
+		std::vector<physx::PxRaycastHit> m_RaycastScratch;
+		std::vector<physx::PxSweepHit> m_SweepScratch;
+		std::vector<uint8_t> m_QueryHasHit;
+		std::vector<std::vector<std::pair<size_t, physx::PxShape*>>> m_OverlapScratch; // 청크별 <쿼리 index, shape>
 
 		void Shutdown();
 
@@ -161,22 +307,52 @@ namespace MMMEngine
 			MMMEngine::RigidBodyComponent* new_rb = nullptr;
 			MMMEngine::ColliderComponent* col = nullptr;
 			MMMEngine::RigidBodyComponent* cur_rb = nullptr;
+			bool alive = true;	//상쇄/취소된 명령은 false (flush 때 건너뛰고 정리)
 		};
 
+		//명령은 요청 순서대로 쌓고(flush 순서 보장), 취소는 키 인덱스로 찾아서 alive만 끔
 		std::vector<Command> m_Commands;
+		std::unordered_map<MMMEngine::RigidBodyComponent*, std::vector<size_t>> m_CmdsByRigid;	 // new_rb 기준
+		std::unordered_map<MMMEngine::ColliderComponent*, std::vector<size_t>> m_CmdsByCollider;	 // col 기준
+		size_t m_DeadCommands = 0;
+
+		void PushCommand(const Command& cmd);
+		//pred를 만족하는 rb(new_rb)/col 의 살아있는 명령을 취소
+		template<typename Pred> void CancelCommandsForRigid(MMMEngine::RigidBodyComponent* rb, Pred pred);
+		template<typename Pred> void CancelCommandsForCollider(MMMEngine::ColliderComponent* col, Pred pred);
+		//취소된 명령 제거 + 인덱스 재구성
+		void CompactCommands();
+		void ClearCommands();
 
 		MMMEngine::PhysScene m_PhysScene;
 
-		//형태가 변한 콜리더를 담아두는 벡터
-		std::unordered_set<MMMEngine::ColliderComponent*> m_DirtyColliders;
+		//형태가 변한 콜리더를 담아두는 벡터 (처리 순서 고정을 위해 요청 순서 배열 + 중복 방지 set)
+		std::vector<MMMEngine::ColliderComponent*> m_DirtyColliders;
+		std::unordered_set<MMMEngine::ColliderComponent*> m_DirtyColliderSet;
 
 		//Unregister가 예약된 rigid만 담는 컨테이너( 제거된게 아닌 제거될 예정인 rigid )
 		std::unordered_set<RigidBodyComponent*> m_PendingUnreg;
 
 		bool m_IsInitialized = false;
 
+		//비동기 스텝 상태
+		bool m_AsyncStep = false;
+		bool m_StepInFlight = false;
+
+
+		std::vector<ColliderComponent*> m_FilterDirtyColliders;
+		std::unordered_set<ColliderComponent*> m_FilterDirtyColliderSet;
+
+		//결정론/롤백 상태
+		bool m_Deterministic = false;
 
-		std::unordered_set<ColliderComponent*> m_FilterDirtyColliders;
+		physx::PxBroadPhaseType::Enum m_BroadPhaseType = physx::PxBroadPhaseType::ePABP;
+		physx::PxBounds3 m_WorldBounds = physx::PxBounds3(physx::PxVec3(-1000.f), physx::PxVec3(1000.f));
+		uint32_t m_BroadPhaseSubdivisions = 8;
+		uint64_t m_StepIndex = 0;
+		uint32_t m_SnapshotHistory = 0;
+		std::vector<PhysicsSnapshot> m_Snapshots;	// step % (history + 1) 위치에 보관
+		void RecordSnapshot();
 
 		
 	};
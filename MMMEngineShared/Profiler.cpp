@@ -0,0 +1,243 @@
+﻿#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+DEFINE_SINGLETON(MMMEngine::Profiler)
+
+namespace
+{
+	thread_local MMMEngine::Profiler::ThreadBuffer* t_buffer = nullptr;
+
+	size_t RoundUpPow2(size_t _value)
+	{
+		size_t pow2 = 1;
+		while (pow2 < _value) pow2 <<= 1;
+		return pow2;
+	}
+
+	void WriteEscaped(std::ofstream& _file, const char* _text)
+	{
+		for (const char* c = _text; c && *c; ++c)
+		{
+			switch (*c)
+			{
+			case '"': _file << "\\\""; break;
+			case '\\': _file << "\\\\"; break;
+			case '\n': _file << "\\n"; break;
+			case '\t': _file << "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(*c) < 0x20) break;
+				_file << *c;
+				break;
+			}
+		}
+	}
+}
+
+uint64_t MMMEngine::Profiler::NowNs()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void MMMEngine::Profiler::StartUp(size_t _eventsPerThread)
+{
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+	// 이미 등록된 스레드 버퍼 크기는 그대로 둠
+	m_capacity = RoundUpPow2(_eventsPerThread < 64 ? 64 : _eventsPerThread);
+	m_originNs = NowNs();
+}
+
+void MMMEngine::Profiler::ShutDown()
+{
+	SetEnabled(false);
+}
+
+void MMMEngine::Profiler::SetEnabled(bool _enabled)
+{
+	if (_enabled && m_originNs == 0)
+		m_originNs = NowNs();
+	m_enabled.store(_enabled, std::memory_order_relaxed);
+}
+
+void MMMEngine::Profiler::BeginFrame()
+{
+	const uint32_t frame = m_frame.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (!IsEnabled()) return;
+
+	ThreadBuffer* buffer = GetThreadBuffer();
+	const uint64_t index = buffer->writeIndex.load(std::memory_order_relaxed);
+	ProfileEvent& e = buffer->events[index & (buffer->events.size() - 1)];
+	e.name = "Frame";
+	e.startNs = NowNs();
+	e.endNs = e.startNs;
+	e.depth = 0;
+	e.frame = frame;
+	e.instant = true;
+	buffer->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+void MMMEngine::Profiler::SetThreadName(const char* _name)
+{
+	ThreadBuffer* buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+	buffer->threadName = _name ? _name : "";
+}
+
+const char* MMMEngine::Profiler::Intern(const std::string& _name)
+{
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+	return m_names.insert(_name).first->c_str();
+}
+
+MMMEngine::Profiler::ThreadBuffer* MMMEngine::Profiler::GetThreadBuffer()
+{
+	if (t_buffer) return t_buffer;
+	t_buffer = RegisterThread();
+	return t_buffer;
+}
+
+MMMEngine::Profiler::ThreadBuffer* MMMEngine::Profiler::RegisterThread()
+{
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+
+	auto buffer = std::make_unique<ThreadBuffer>(m_capacity);
+	buffer->threadId = static_cast<uint32_t>(m_threads.size());
+	buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+
+	m_threads.push_back(std::move(buffer));
+	return m_threads.back().get();
+}
+
+void MMMEngine::Profiler::Clear()
+{
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+	for (auto& buffer : m_threads)
+		buffer->writeIndex.store(0, std::memory_order_release);
+	m_originNs = NowNs();
+}
+
+void MMMEngine::Profiler::CollectFrameZones(uint32_t _frame, std::vector<ProfileZoneStat>& _out)
+{
+	_out.clear();
+
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+	for (const auto& buffer : m_threads)
+	{
+		const size_t capacity = buffer->events.size();
+		const uint64_t end = buffer->writeIndex.load(std::memory_order_acquire);
+		const uint64_t begin = (end > capacity) ? end - capacity : 0;
+
+		// 뒤에서부터 모은 다음 뒤집어서 기록순으로 맞춤
+		const size_t first = _out.size();
+		for (uint64_t i = end; i > begin; --i)
+		{
+			const ProfileEvent& e = buffer->events[(i - 1) & (capacity - 1)];
+			if (e.frame < _frame) break;
+			if (e.frame != _frame || e.instant || !e.name) continue;
+
+			const double ms = static_cast<double>(e.endNs - e.startNs) / 1000000.0;
+			auto it = std::find_if(_out.begin(), _out.end(),
+				[&](const ProfileZoneStat& s) { return s.name == e.name; });
+			if (it == _out.end())
+			{
+				_out.push_back({ e.name, e.depth, 1, ms });
+				continue;
+			}
+
+			it->depth = (std::min)(it->depth, e.depth);
+			++it->callCount;
+			it->totalMs += ms;
+		}
+		std::reverse(_out.begin() + first, _out.end());
+	}
+}
+
+bool MMMEngine::Profiler::ExportChromeTrace(const std::filesystem::path& _path)
+{
+	std::error_code ec;
+	if (_path.has_parent_path())
+		std::filesystem::create_directories(_path.parent_path(), ec);
+
+	std::ofstream file(_path, std::ios::trunc);
+	if (!file) return false;
+
+	std::lock_guard<std::mutex> lock(m_registryMutex);
+
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	bool first = true;
+	char number[64];
+
+	for (const auto& buffer : m_threads)
+	{
+		if (!first) file << ',';
+		first = false;
+		file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":\"";
+		WriteEscaped(file, buffer->threadName.c_str());
+		file << "\"}}";
+
+		// 기록중인 스레드와 겹칠 수 있으니 write 인덱스 기준으로 링 크기만큼만 읽음
+		const size_t capacity = buffer->events.size();
+		const uint64_t end = buffer->writeIndex.load(std::memory_order_acquire);
+		const uint64_t begin = (end > capacity) ? end - capacity : 0;
+
+		for (uint64_t i = begin; i < end; ++i)
+		{
+			const ProfileEvent& e = buffer->events[i & (capacity - 1)];
+			if (!e.name || e.startNs < m_originNs) continue;
+
+			const double ts = static_cast<double>(e.startNs - m_originNs) / 1000.0;
+			file << ",{\"name\":\"";
+			WriteEscaped(file, e.name);
+			file << "\",\"pid\":1,\"tid\":" << buffer->threadId;
+
+			std::snprintf(number, sizeof(number), "%.3f", ts);
+			file << ",\"ts\":" << number;
+
+			if (e.instant)
+			{
+				file << ",\"ph\":\"i\",\"s\":\"g\",\"args\":{\"frame\":" << e.frame << "}}";
+			}
+			else
+			{
+				const double dur = static_cast<double>(e.endNs - e.startNs) / 1000.0;
+				std::snprintf(number, sizeof(number), "%.3f", dur);
+				file << ",\"ph\":\"X\",\"dur\":" << number << ",\"args\":{\"frame\":" << e.frame << "}}";
+			}
+		}
+	}
+
+	file << "]}";
+	return file.good();
+}
+
+MMMEngine::ProfileScope::ProfileScope(const char* _name)
+{
+	Profiler& profiler = Profiler::Get();
+	if (!profiler.IsEnabled()) return;
+
+	m_buffer = profiler.GetThreadBuffer();
+	m_name = _name;
+	m_depth = m_buffer->depth++;
+	m_startNs = Profiler::NowNs();
+}
+
+MMMEngine::ProfileScope::~ProfileScope()
+{
+	if (!m_buffer) return;
+
+	const uint64_t endNs = Profiler::NowNs();
+	--m_buffer->depth;
+
+	const uint64_t index = m_buffer->writeIndex.load(std::memory_order_relaxed);
+	ProfileEvent& e = m_buffer->events[index & (m_buffer->events.size() - 1)];
+	e.name = m_name;
+	e.startNs = m_startNs;
+	e.endNs = endNs;
+	e.depth = m_depth;
+	e.frame = Profiler::Get().GetFrameIndex();
+	e.instant = false;
+	m_buffer->writeIndex.store(index + 1, std::memory_order_release);
+}
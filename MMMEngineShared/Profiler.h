@@ -0,0 +1,144 @@
+﻿#pragma once
+#include "ExportSingleton.hpp"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// 0으로 정의하고 빌드하면 MMM_PROFILE_* 매크로가 전부 빈 코드가 됨 (기록 비용 0)
+#ifndef MMMENGINE_PROFILER
+#define MMMENGINE_PROFILER 1
+#endif
+
+// 아래는 표준라이브러리 (std::)의 dll export경고를 없애기 위한코드 
+// EngineShared는 ABI가 유지됨이 보장되기때문에 4251경고에 대해 안전함
+#pragma warning(push)
+#pragma warning(disable: 4251)
+
+namespace MMMEngine
+{
+	struct ProfileEvent
+	{
+		const char* name = nullptr;	// 정적 문자열 또는 Profiler::Intern 결과만 허용
+		uint64_t startNs = 0;
+		uint64_t endNs = 0;
+		uint32_t depth = 0;
+		uint32_t frame = 0;
+		bool instant = false;		// 프레임 경계 표시
+	};
+
+	// 한 프레임 동안 같은 이름 zone의 합계 (스레드 구분 없이 합침)
+	struct ProfileZoneStat
+	{
+		const char* name = nullptr;
+		uint32_t depth = 0;			// 가장 얕은 호출 깊이
+		uint32_t callCount = 0;
+		double totalMs = 0.0;
+	};
+
+	// 계층형 CPU 프로파일러
+	// 스레드마다 고정 크기 링버퍼를 하나씩 가지고, 기록은 소유 스레드만 하므로 락이 없음
+	// 오래된 이벤트는 덮어쓰여서 최근 구간만 남음
+	class MMMENGINE_API Profiler : public Utility::ExportSingleton<Profiler>
+	{
+		friend class Utility::ExportSingleton<Profiler>;
+	public:
+		struct ThreadBuffer
+		{
+			explicit ThreadBuffer(size_t _capacity) : events(_capacity) {}
+
+			std::vector<ProfileEvent> events;	// 크기는 2의 거듭제곱
+			std::atomic<uint64_t> writeIndex{ 0 };
+			uint32_t depth = 0;
+			uint32_t threadId = 0;
+			std::string threadName;
+		};
+
+	private:
+		Profiler() = default;
+		~Profiler() = default;
+
+		std::atomic<bool> m_enabled{ false };
+		std::atomic<uint32_t> m_frame{ 0 };
+		size_t m_capacity = size_t(1) << 16;
+		uint64_t m_originNs = 0;
+
+		// 스레드 등록/이름 intern만 보호 (기록 경로에서는 잡지 않음)
+		std::mutex m_registryMutex;
+		// 스레드가 끝나도 버퍼는 유지 (thread_local 포인터가 가리키고 있으므로 프로세스 종료까지 해제하지 않음)
+		std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+		std::unordered_set<std::string> m_names;
+
+		ThreadBuffer* RegisterThread();
+
+	public:
+		static uint64_t NowNs();
+
+		// _eventsPerThread는 2의 거듭제곱으로 올림
+		void StartUp(size_t _eventsPerThread = size_t(1) << 16);
+		void ShutDown();
+
+		void SetEnabled(bool _enabled);
+		bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+		// 메인 루프 시작마다 호출 (프레임 번호 증가 + 경계 이벤트 기록)
+		void BeginFrame();
+		uint32_t GetFrameIndex() const { return m_frame.load(std::memory_order_relaxed); }
+
+		// 호출한 스레드의 trace 표시 이름
+		void SetThreadName(const char* _name);
+
+		// 런타임에 만들어지는 이름(메시지 이름 등)을 수명이 보장되는 문자열로 바꿈 //락을 잡으니 핫루프 밖에서 호출
+		const char* Intern(const std::string& _name);
+
+		// 호출한 스레드의 버퍼 (첫 호출에 등록)
+		ThreadBuffer* GetThreadBuffer();
+
+		// 기록 중지 상태에서 호출
+		void Clear();
+
+		// _frame 번 프레임에 끝난 zone을 이름별로 합산 (기록순, 에디터 표시용)
+		// 링버퍼를 뒤에서부터 읽다가 이전 프레임을 만나면 멈춤 //진행중인 프레임은 아직 안 끝난 zone이 빠져있음
+		void CollectFrameZones(uint32_t _frame, std::vector<ProfileZoneStat>& _out);
+
+		// 버퍼에 남아있는 이벤트를 Chrome trace(JSON, chrome://tracing / Perfetto)로 저장
+		bool ExportChromeTrace(const std::filesystem::path& _path);
+	};
+
+	class MMMENGINE_API ProfileScope
+	{
+	public:
+		explicit ProfileScope(const char* _name);
+		~ProfileScope();
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		Profiler::ThreadBuffer* m_buffer = nullptr;
+		const char* m_name = nullptr;
+		uint64_t m_startNs = 0;
+		uint32_t m_depth = 0;
+	};
+}
+
+#pragma warning(pop)
+
+#if MMMENGINE_PROFILER
+#define MMM_PROFILE_CONCAT_INNER(a, b) a##b
+#define MMM_PROFILE_CONCAT(a, b) MMM_PROFILE_CONCAT_INNER(a, b)
+#define MMM_PROFILE_SCOPE(name) ::MMMEngine::ProfileScope MMM_PROFILE_CONCAT(_mmmProfileScope, __LINE__)(name)
+#define MMM_PROFILE_FUNCTION() MMM_PROFILE_SCOPE(__FUNCTION__)
+// std::string 이름용 (기록중일때만 Intern)
+#define MMM_PROFILE_SCOPE_DYNAMIC(name) MMM_PROFILE_SCOPE(::MMMEngine::Profiler::Get().IsEnabled() ? ::MMMEngine::Profiler::Get().Intern(name) : nullptr)
+#define MMM_PROFILE_FRAME() ::MMMEngine::Profiler::Get().BeginFrame()
+#else
+#define MMM_PROFILE_SCOPE(name) ((void)0)
+#define MMM_PROFILE_SCOPE_DYNAMIC(name) ((void)0)
+#define MMM_PROFILE_FUNCTION() ((void)0)
+#define MMM_PROFILE_FRAME() ((void)0)
+#endif
@@ -0,0 +1,119 @@
+﻿#include "RenderBackend.h"
+#include "RendererTools.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace Microsoft::WRL;
+
+MMMEngine::D3D11RenderBackend::D3D11RenderBackend(ComPtr<ID3D11Device5> _device, ComPtr<ID3D11DeviceContext4> _context)
+	: m_pDevice(_device), m_pContext(_context)
+{
+	D3D11_BUFFER_DESC bd = {};
+	bd.Usage = D3D11_USAGE_DEFAULT;
+	bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	bd.CPUAccessFlags = 0;
+	bd.ByteWidth = sizeof(Render_TransformBuffer);
+	HR_T(m_pDevice->CreateBuffer(&bd, nullptr, m_pTransbuffer.GetAddressOf()));
+
+	// 상수버퍼 오프셋 바인딩 지원 확인 (지원하면 트랜스폼을 프레임당 한번에 업로드)
+	D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+	if (SUCCEEDED(m_pDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))))
+		m_useCBufferOffset = options.ConstantBufferOffsetting == TRUE;
+}
+
+void MMMEngine::D3D11RenderBackend::SetVertexShader(ID3D11VertexShader* _vs)
+{
+	m_pContext->VSSetShader(_vs, nullptr, 0);
+}
+
+void MMMEngine::D3D11RenderBackend::SetPixelShader(ID3D11PixelShader* _ps)
+{
+	m_pContext->PSSetShader(_ps, nullptr, 0);
+}
+
+void MMMEngine::D3D11RenderBackend::SetInputLayout(ID3D11InputLayout* _layout)
+{
+	m_pContext->IASetInputLayout(_layout);
+}
+
+void MMMEngine::D3D11RenderBackend::SetPSSampler(UINT _slot, ID3D11SamplerState* _sampler)
+{
+	m_pContext->PSSetSamplers(_slot, 1, &_sampler);
+}
+
+void MMMEngine::D3D11RenderBackend::SetPSConstantBuffer(UINT _slot, ID3D11Buffer* _buffer)
+{
+	m_pContext->PSSetConstantBuffers(_slot, 1, &_buffer);
+}
+
+void MMMEngine::D3D11RenderBackend::SetPSShaderResource(UINT _slot, ID3D11ShaderResourceView* _srv)
+{
+	m_pContext->PSSetShaderResources(_slot, 1, &_srv);
+}
+
+void MMMEngine::D3D11RenderBackend::SetVertexBuffer(ID3D11Buffer* _buffer, UINT _stride)
+{
+	UINT offset = 0;
+	m_pContext->IASetVertexBuffers(0, 1, &_buffer, &_stride, &offset);
+}
+
+void MMMEngine::D3D11RenderBackend::SetIndexBuffer(ID3D11Buffer* _buffer)
+{
+	m_pContext->IASetIndexBuffer(_buffer, DXGI_FORMAT_R32_UINT, 0);
+}
+
+void MMMEngine::D3D11RenderBackend::UploadTransformSlots(const Render_TransformSlot* _slots, size_t _count)
+{
+	if (!m_useCBufferOffset || _count == 0)
+		return;
+
+	// 용량 부족시 버퍼 재생성 (2배씩)
+	if (m_transSlotCapacity < _count)
+	{
+		UINT capacity = std::max<UINT>(m_transSlotCapacity, 256);
+		while (capacity < _count)
+			capacity *= 2;
+
+		D3D11_BUFFER_DESC bd = {};
+		bd.Usage = D3D11_USAGE_DYNAMIC;
+		bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		bd.ByteWidth = capacity * sizeof(Render_TransformSlot);
+
+		m_pTransSlotBuffer.Reset();
+		HR_T(m_pDevice->CreateBuffer(&bd, nullptr, m_pTransSlotBuffer.GetAddressOf()));
+		m_transSlotCapacity = capacity;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE mapped;
+	if (SUCCEEDED(m_pContext->Map(m_pTransSlotBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+	{
+		memcpy(mapped.pData, _slots, _count * sizeof(Render_TransformSlot));
+		m_pContext->Unmap(m_pTransSlotBuffer.Get(), 0);
+	}
+}
+
+void MMMEngine::D3D11RenderBackend::BindTransformSlot(UINT _index, const Render_TransformSlot& _slot)
+{
+	if (m_useCBufferOffset)
+	{
+		UINT firstConstant = _index * TRANSFORM_SLOT_CONSTANTS;
+		UINT numConstants = TRANSFORM_SLOT_CONSTANTS;
+		m_pContext->VSSetConstantBuffers1(1, 1, m_pTransSlotBuffer.GetAddressOf(), &firstConstant, &numConstants);
+	}
+	else
+	{
+		m_pContext->UpdateSubresource1(m_pTransbuffer.Get(), 0, nullptr, &_slot.buffer, 0, 0, D3D11_COPY_DISCARD);
+		m_pContext->VSSetConstantBuffers(1, 1, m_pTransbuffer.GetAddressOf());
+	}
+}
+
+void MMMEngine::D3D11RenderBackend::UpdateBuffer(ID3D11Buffer* _buffer, const void* _data)
+{
+	m_pContext->UpdateSubresource1(_buffer, 0, nullptr, _data, 0, 0, D3D11_COPY_DISCARD);
+}
+
+void MMMEngine::D3D11RenderBackend::DrawIndexed(UINT _indexCount)
+{
+	m_pContext->DrawIndexed(_indexCount, 0, 0);
+}
@@ -0,0 +1,116 @@
+﻿#pragma once
+#include <d3d11_4.h>
+#include <wrl/client.h>
+#include <cstdint>
+
+#include "Export.h"
+#include "RenderShared.h"
+
+namespace MMMEngine
+{
+	// 백엔드 호출 통계 (널 백엔드에서 기록, 테스트/벤치마크 확인용)
+	struct RenderBackendStats
+	{
+		uint64_t drawCalls = 0;
+		uint64_t shaderBinds = 0;			// VS, PS, InputLayout
+		uint64_t resourceBinds = 0;			// CB, SRV, Sampler, VB, IB
+		uint64_t transformBinds = 0;
+		uint64_t bufferUpdates = 0;
+		uint64_t uploadedBytes = 0;
+		uint64_t indexCount = 0;
+	};
+
+	// RenderManager 커맨드 실행부가 사용하는 디바이스 호출 모음
+	// D3D11 구현은 컨텍스트로 그대로 전달, 널 구현은 호출만 기록함
+	class MMMENGINE_API RenderBackend
+	{
+	public:
+		virtual ~RenderBackend() = default;
+
+		// 헤드리스면 nullptr (메테리얼 굽기에서 GPU 업로드 생략)
+		virtual ID3D11DeviceContext4* GetContext() const { return nullptr; }
+
+		virtual void SetVertexShader(ID3D11VertexShader* _vs) = 0;
+		virtual void SetPixelShader(ID3D11PixelShader* _ps) = 0;
+		virtual void SetInputLayout(ID3D11InputLayout* _layout) = 0;
+		virtual void SetPSSampler(UINT _slot, ID3D11SamplerState* _sampler) = 0;
+		virtual void SetPSConstantBuffer(UINT _slot, ID3D11Buffer* _buffer) = 0;
+		virtual void SetPSShaderResource(UINT _slot, ID3D11ShaderResourceView* _srv) = 0;
+		virtual void SetVertexBuffer(ID3D11Buffer* _buffer, UINT _stride) = 0;
+		virtual void SetIndexBuffer(ID3D11Buffer* _buffer) = 0;
+
+		// 프레임 트랜스폼 슬롯 업로드 / 드로우별 슬롯 바인딩 (VS b1)
+		virtual void UploadTransformSlots(const Render_TransformSlot* _slots, size_t _count) = 0;
+		virtual void BindTransformSlot(UINT _index, const Render_TransformSlot& _slot) = 0;
+
+		// DEFAULT 버퍼 통째로 갱신
+		virtual void UpdateBuffer(ID3D11Buffer* _buffer, const void* _data) = 0;
+		virtual void DrawIndexed(UINT _indexCount) = 0;
+
+		const RenderBackendStats& GetStats() const { return m_stats; }
+		void ResetStats() { m_stats = RenderBackendStats{}; }
+
+	protected:
+		RenderBackendStats m_stats;
+	};
+
+	class MMMENGINE_API D3D11RenderBackend : public RenderBackend
+	{
+	private:
+		Microsoft::WRL::ComPtr<ID3D11Device5> m_pDevice;
+		Microsoft::WRL::ComPtr<ID3D11DeviceContext4> m_pContext;
+
+		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pTransbuffer;		// 단일 슬롯 버퍼 (오프셋 바인딩 미지원시)
+		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pTransSlotBuffer;	// 프레임 전체 슬롯 버퍼
+		UINT m_transSlotCapacity = 0;
+		bool m_useCBufferOffset = false;							// VSSetConstantBuffers1 오프셋 지원여부
+
+	public:
+		D3D11RenderBackend(Microsoft::WRL::ComPtr<ID3D11Device5> _device, Microsoft::WRL::ComPtr<ID3D11DeviceContext4> _context);
+
+		ID3D11DeviceContext4* GetContext() const override { return m_pContext.Get(); }
+
+		void SetVertexShader(ID3D11VertexShader* _vs) override;
+		void SetPixelShader(ID3D11PixelShader* _ps) override;
+		void SetInputLayout(ID3D11InputLayout* _layout) override;
+		void SetPSSampler(UINT _slot, ID3D11SamplerState* _sampler) override;
+		void SetPSConstantBuffer(UINT _slot, ID3D11Buffer* _buffer) override;
+		void SetPSShaderResource(UINT _slot, ID3D11ShaderResourceView* _srv) override;
+		void SetVertexBuffer(ID3D11Buffer* _buffer, UINT _stride) override;
+		void SetIndexBuffer(ID3D11Buffer* _buffer) override;
+
+		void UploadTransformSlots(const Render_TransformSlot* _slots, size_t _count) override;
+		void BindTransformSlot(UINT _index, const Render_TransformSlot& _slot) override;
+
+		void UpdateBuffer(ID3D11Buffer* _buffer, const void* _data) override;
+		void DrawIndexed(UINT _indexCount) override;
+	};
+
+	// 디바이스 없이 프레임 파이프라인을 돌리기 위한 백엔드 (CI, 벤치마크)
+	class MMMENGINE_API NullRenderBackend : public RenderBackend
+	{
+	public:
+		void SetVertexShader(ID3D11VertexShader*) override { ++m_stats.shaderBinds; }
+		void SetPixelShader(ID3D11PixelShader*) override { ++m_stats.shaderBinds; }
+		void SetInputLayout(ID3D11InputLayout*) override { ++m_stats.shaderBinds; }
+		void SetPSSampler(UINT, ID3D11SamplerState*) override { ++m_stats.resourceBinds; }
+		void SetPSConstantBuffer(UINT, ID3D11Buffer*) override { ++m_stats.resourceBinds; }
+		void SetPSShaderResource(UINT, ID3D11ShaderResourceView*) override { ++m_stats.resourceBinds; }
+		void SetVertexBuffer(ID3D11Buffer*, UINT) override { ++m_stats.resourceBinds; }
+		void SetIndexBuffer(ID3D11Buffer*) override { ++m_stats.resourceBinds; }
+
+		void UploadTransformSlots(const Render_TransformSlot*, size_t _count) override
+		{
+			++m_stats.bufferUpdates;
+			m_stats.uploadedBytes += _count * sizeof(Render_TransformSlot);
+		}
+		void BindTransformSlot(UINT, const Render_TransformSlot&) override { ++m_stats.transformBinds; }
+
+		void UpdateBuffer(ID3D11Buffer*, const void*) override { ++m_stats.bufferUpdates; }
+		void DrawIndexed(UINT _indexCount) override
+		{
+			++m_stats.drawCalls;
+			m_stats.indexCount += _indexCount;
+		}
+	};
+}
@@ -9,12 +9,21 @@
 #include "Camera.h"
 #include "Renderer.h"
 #include "Material.h"
+#include "JobSystem.h"
+#include "Profiler.h"
 
 #include "rttr/registration.h"
 #include <cmath>
+#include <algorithm>
 
 DEFINE_SINGLETON(MMMEngine::RenderManager)
 
+namespace
+{
+	// 워커에서 Render() 중일때만 설정됨 (AddCommand / AddMatrix 가 여기로 기록)
+	thread_local MMMEngine::RenderCommandList* t_pCommandList = nullptr;
+}
+
 using namespace Microsoft::WRL;
 using namespace DirectX::SimpleMath;
 using namespace DirectX;
@@ -36,31 +45,126 @@ namespace MMMEngine {
 		m_projMatrix = Matrix::Identity;
 	}
 
-	void RenderManager::ApplyMatToContext(ID3D11DeviceContext4* _context, Material* _material)
+	void RenderManager::ResetStateCache()
+	{
+		// 패스 사이에 외부(에디터, 피킹 등)에서 상태를 바꿀 수 있으므로 매 패스 초기화
+		m_stateCache = StateCache{};
+	}
+
+	void RenderManager::ApplyMatToContext(Material* _material)
 	{
 		if (!_material->GetPShader())
 			return;
 
 		auto VS = _material->GetVShader();
 		auto PS = _material->GetPShader();
-		ShaderType type = ShaderInfo::Get().GetShaderType(PS->GetFilePath());
-		_context->VSSetShader(VS->m_pVShader.Get(), nullptr, 0);
-		_context->PSSetShader(PS->m_pPShader.Get(), nullptr, 0);
+
+		ID3D11VertexShader* vs = VS->m_pVShader.Get();
+		if (m_stateCache.vs != vs) {
+			m_pBackend->SetVertexShader(vs);
+			m_stateCache.vs = vs;
+		}
+		else ++m_skippedBinds;
+
+		ID3D11PixelShader* ps = PS->m_pPShader.Get();
+		if (m_stateCache.ps != ps) {
+			m_pBackend->SetPixelShader(ps);
+			m_stateCache.ps = ps;
+		}
+		else ++m_skippedBinds;
 
 		// TODO::인풋레이아웃 ShaderInfo 사용해 자동등록 시키기
-		_context->IASetInputLayout(_material->GetVShader()->m_pInputLayout.Get());
+		ID3D11InputLayout* layout = VS->m_pInputLayout.Get();
+		if (m_stateCache.layout != layout) {
+			m_pBackend->SetInputLayout(layout);
+			m_stateCache.layout = layout;
+		}
+		else ++m_skippedBinds;
 
 		// TODO::샘플러 ShaderInfo 사용해 자동등록화 시키기 (UpdateProperty 사용, 프로퍼티로 샘플러 관리하기)
-		_context->PSSetSamplers(0, 1, m_pDafaultSampler.GetAddressOf());
+		if (m_stateCache.sampler != m_pDafaultSampler.Get()) {
+			m_pBackend->SetPSSampler(0, m_pDafaultSampler.Get());
+			m_stateCache.sampler = m_pDafaultSampler.Get();
+		}
+		else ++m_skippedBinds;
+
+		// 메테리얼 (미리 구워둔 상수블록 + SRV 테이블 바인딩)
+		const MaterialBinding& binding = ShaderInfo::Get().BakeMaterial(m_pBackend->GetContext(), _material);
+
+		for (auto& baked : binding.cbuffers)
+		{
+			if (baked.registerIndex < 0 || !baked.buffer)
+				continue;
+
+			ID3D11Buffer* buffer = baked.buffer.Get();
+			if (m_stateCache.psCBuffers[baked.registerIndex] != buffer) {
+				m_pBackend->SetPSConstantBuffer(baked.registerIndex, buffer);
+				m_stateCache.psCBuffers[baked.registerIndex] = buffer;
+			}
+			else ++m_skippedBinds;
+		}
+
+		for (auto& [slot, srv] : binding.srvs)
+		{
+			if (m_stateCache.psSRVs[slot] != srv) {
+				m_pBackend->SetPSShaderResource(slot, srv);
+				m_stateCache.psSRVs[slot] = srv;
+			}
+			else ++m_skippedBinds;
+		}
+	}
+
+	void RenderManager::UploadTransforms()
+	{
+		const size_t count = m_objWorldMats.size();
+		if (count == 0)
+			return;
+
+		// 슬롯 배열 확장 (새 슬롯은 캐시 비교대상에서 제외)
+		size_t cachedCount = std::min(m_cachedWorldMats.size(), count);
+		if (m_transformSlots.size() < count)
+		{
+			m_transformSlots.resize(count);
+			m_cachedWorldMats.resize(count);
+		}
+
+		BatchTransformSlots(m_objWorldMats.data(), m_cachedWorldMats.data(), m_transformSlots.data(), count, cachedCount);
 
-		// 메테리얼
-		for (auto& [prop, val] : _material->GetProperties()) {
-			UpdateProperty(prop, val, type);
+		m_pBackend->UploadTransformSlots(m_transformSlots.data(), count);
+	}
+
+	void RenderManager::BindTransformSlot(int _worldMatIndex)
+	{
+		if (_worldMatIndex < 0 || static_cast<size_t>(_worldMatIndex) >= m_objWorldMats.size())
+			return;
+
+		m_pBackend->BindTransformSlot(static_cast<UINT>(_worldMatIndex), m_transformSlots[_worldMatIndex]);
+	}
+
+	void RenderManager::DrawCommand(const RenderCommand& _cmd)
+	{
+		if (m_stateCache.vertexBuffer != _cmd.vertexBuffer) {
+			m_pBackend->SetVertexBuffer(_cmd.vertexBuffer, sizeof(Mesh_Vertex));
+			m_stateCache.vertexBuffer = _cmd.vertexBuffer;
 		}
+		else ++m_skippedBinds;
+
+		if (m_stateCache.indexBuffer != _cmd.indexBuffer) {
+			m_pBackend->SetIndexBuffer(_cmd.indexBuffer);
+			m_stateCache.indexBuffer = _cmd.indexBuffer;
+		}
+		else ++m_skippedBinds;
+
+		// 월드매트릭스 슬롯 바인딩 (BeginFrame에서 미리 계산, 업로드됨)
+		BindTransformSlot(_cmd.worldMatIndex);
+
+		m_pBackend->DrawIndexed(_cmd.indiciesSize);
 	}
 
 	void RenderManager::ExcuteCommands()
 	{
+		ResetStateCache();
+
 		for (auto& [type, commands] : m_renderCommands)
 		{
 			if (type == RenderType::R_TRANSCULANT)
@@ -109,45 +213,28 @@ namespace MMMEngine {
 
 				if (cMat != lMat)
 				{
-					ApplyMatToContext(m_pDeviceContext.Get(), cMat.get());
+					ApplyMatToContext(cMat.get());
 					lastMaterial = cmd.material;
 					lMat = cMat;
 				}
 
 
-				UINT stride = sizeof(Mesh_Vertex); // 실제 버텍스 구조체 크기
-				UINT offset = 0;
-				m_pDeviceContext->IASetVertexBuffers(0, 1, &cmd.vertexBuffer, &stride, &offset);
-				m_pDeviceContext->IASetIndexBuffer(cmd.indexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
 				if (cmd.boneMatIndex >= 0)
 				{
 					// 스킨드 메시라면 본 인덱스를 셰이더에 전달
 					// UpdateBoneIndexConstantBuffer(cmd.boneMatIndex);
 				}
 
-				// 상수버퍼 등록
-				auto sType = ShaderInfo::Get().GetShaderType(lMat->GetPShader()->GetFilePath());
-
-				// 상수버퍼 일렬업데이트
-				ShaderInfo::Get().UpdateCBuffers(sType);
-
-				// 월드매트릭스 버퍼집어넣기
-				Render_TransformBuffer transformBuffer;
-				transformBuffer.mWorld = XMMatrixTranspose(m_objWorldMatMap[cmd.worldMatIndex]);
-				transformBuffer.mNormalMatrix = XMMatrixInverse(nullptr, m_objWorldMatMap[cmd.worldMatIndex]);
-				m_pDeviceContext->UpdateSubresource1(m_pTransbuffer.Get(), 0, nullptr, &transformBuffer, 0, 0, D3D11_COPY_DISCARD);
-				m_pDeviceContext->VSSetConstantBuffers(1, 1, m_pTransbuffer.GetAddressOf());
-
-				m_pDeviceContext->DrawIndexed(cmd.indiciesSize, 0, 0);
+				DrawCommand(cmd);
 			}
 		}
 	}
 
 	void RenderManager::InitCache()
 	{
-		// 캐싱 컨테이너 초기화
-		m_objWorldMatMap.clear();
+		// 캐싱 컨테이너 초기화 (슬롯 캐시는 다음 프레임 비교용으로 유지)
+		m_objWorldMats.clear();
+		m_skippedBinds = 0;
 		m_renderCommands.clear();
 		m_rObjIdx = 0;
 	}
@@ -168,10 +255,73 @@ namespace MMMEngine {
 
 	void RenderManager::UpdateRenderers()
 	{
+		// 병렬 가능한 렌더러는 메인에서 준비만 해두고 모아둠
+		m_parallelRenderers.clear();
 		for (auto& renderer : m_renderers) {
-			if (renderer->IsActiveAndEnabled()) {
+			if (!renderer->IsActiveAndEnabled())
+				continue;
+
+			if (renderer->IsParallelRenderable()) {
+				renderer->PrepareRender();
+				m_parallelRenderers.push_back(renderer);
+			}
+			else {
+				renderer->Render();
+			}
+		}
+
+		if (m_parallelRenderers.empty())
+			return;
+
+		// 적으면 분배 비용이 더 크니 그냥 메인에서 처리
+		if (m_parallelRenderers.size() < m_parallelRenderThreshold || JobSystem::Get().GetWorkerCount() == 0) {
+			for (auto& renderer : m_parallelRenderers)
 				renderer->Render();
+			return;
+		}
+
+		const size_t chunkCount = JobSystem::Get().GetChunkCount();
+		if (m_commandLists.size() < chunkCount)
+			m_commandLists.resize(chunkCount);
+		for (auto& list : m_commandLists)
+			list.Clear();
+
+		JobSystem::Get().ParallelFor(m_parallelRenderers.size(), m_parallelRenderThreshold / chunkCount,
+			[this](size_t _begin, size_t _end, size_t _chunk)
+			{
+				t_pCommandList = &m_commandLists[_chunk];
+				for (size_t i = _begin; i < _end; ++i)
+					m_parallelRenderers[i]->Render();
+				t_pCommandList = nullptr;
+			});
+
+		MergeCommandLists();
+	}
+
+	void RenderManager::MergeCommandLists()
+	{
+		// 청크 순서대로 붙여서 직렬 실행과 같은 인덱스 순서 유지
+		for (auto& list : m_commandLists)
+		{
+			const int base = static_cast<int>(m_objWorldMats.size());
+			m_objWorldMats.insert(m_objWorldMats.end(), list.worldMats.begin(), list.worldMats.end());
+			m_rObjIdx += static_cast<unsigned int>(list.worldMats.size());
+
+			for (int type = 0; type < RenderType::R_END; ++type)
+			{
+				auto& src = list.commands[type];
+				if (src.empty())
+					continue;
+
+				auto& dst = m_renderCommands[static_cast<RenderType>(type)];
+				dst.reserve(dst.size() + src.size());
+				for (auto& cmd : src)
+				{
+					cmd.worldMatIndex += base;
+					dst.push_back(std::move(cmd));
+				}
 			}
+			list.Clear();
 		}
 	}
 
@@ -207,6 +357,19 @@ namespace MMMEngine {
 		InitD3D();
 		Start();
 	}
+	void RenderManager::StartUpHeadless(UINT _ClientWidth, UINT _ClientHeight)
+	{
+		m_isHeadless = true;
+		m_hWnd = nullptr;
+		m_clientWidth = _ClientWidth;
+		m_clientHeight = _ClientHeight;
+		m_sceneWidth = _ClientWidth;
+		m_sceneHeight = _ClientHeight;
+
+		m_pBackend = std::make_unique<NullRenderBackend>();
+		Start();
+	}
+
 	void RenderManager::InitD3D()
 	{
 		// 스왑체인 속성설정 생성
@@ -389,11 +552,18 @@ namespace MMMEngine {
 
 		bd.ByteWidth = sizeof(Render_CamBuffer);
 		HR_T(m_pDevice->CreateBuffer(&bd, nullptr, m_pCambuffer.GetAddressOf()));
-		bd.ByteWidth = sizeof(Render_TransformBuffer);
-		HR_T(m_pDevice->CreateBuffer(&bd, nullptr, &m_pTransbuffer));
+
+		// 커맨드 실행 백엔드
+		m_pBackend = std::make_unique<D3D11RenderBackend>(m_pDevice, m_pDeviceContext);
 	}
 	void RenderManager::ShutDown()
 	{
+		m_pBackend.reset();
+		if (m_isHeadless) {
+			m_isHeadless = false;
+			return;
+		}
+
 		// COM객체 초기화
 		m_pDevice->Release();
 		m_pDeviceContext->Release();
@@ -414,31 +584,6 @@ namespace MMMEngine {
 		m_ClearColor = DirectX::SimpleMath::Vector4(0.45f, 0.55f, 0.60f, 1.00f);
 	}
 
-	void RenderManager::UpdateProperty(const std::wstring& _propName, const PropertyValue& _value, ShaderType _type)
-	{
-		std::visit([&](auto&& arg)
-			{
-				using T = std::decay_t<decltype(arg)>;
-
-				if constexpr (std::is_same_v<T, int> ||
-					std::is_same_v<T, float> ||
-					std::is_same_v<T, DirectX::SimpleMath::Vector3> ||
-					std::is_same_v<T, DirectX::SimpleMath::Vector4> ||
-					std::is_same_v<T, DirectX::SimpleMath::Matrix>)
-				{
-					ShaderInfo::Get().UpdateProperty(m_pDeviceContext.Get(), _type, _propName, &arg);
-				}
-				else if constexpr (std::is_same_v<T, ResPtr<MMMEngine::Texture2D>>)
-				{
-					if (arg == nullptr)
-						return;
-
-					ID3D11ShaderResourceView* srv = arg->m_pSRV.Get();
-					ShaderInfo::Get().UpdateProperty(m_pDeviceContext.Get(), _type, _propName, srv);
-				}
-			}, _value);
-	}
-
 	void RenderManager::SetWorldMatrix(DirectX::SimpleMath::Matrix& _world)
 	{
 		m_worldMatrix = _world;
@@ -458,6 +603,8 @@ namespace MMMEngine {
 	{
 		m_clientWidth = width;
 		m_clientHeight = height;
+		if (m_isHeadless)
+			return;
 
 		// RTV 등록해제
 		m_pDeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
@@ -504,6 +651,8 @@ namespace MMMEngine {
 	{
 		m_sceneWidth = _sceneWidth;
 		m_sceneHeight = _sceneHeight;
+		if (m_isHeadless)
+			return;
 
 		// 기존 리소스 해제
 		if (m_pSceneRTV) { m_pSceneRTV->Release(); }
@@ -570,13 +719,22 @@ namespace MMMEngine {
 
 	void RenderManager::AddCommand(RenderType _type, RenderCommand&& _command)
 	{
+		if (t_pCommandList) {
+			t_pCommandList->commands[_type].push_back(std::move(_command));
+			return;
+		}
 		m_renderCommands[_type].push_back(std::move(_command));
 	}
 
 	int RenderManager::AddMatrix(const DirectX::SimpleMath::Matrix& _worldMatrix)
 	{
+		if (t_pCommandList) {
+			t_pCommandList->worldMats.push_back(_worldMatrix);
+			return static_cast<int>(t_pCommandList->worldMats.size()) - 1;
+		}
+
 		int index = m_rObjIdx++;
-		m_objWorldMatMap[index] = _worldMatrix;
+		m_objWorldMats.push_back(_worldMatrix);
 
 		return index;
 	}
@@ -586,19 +744,37 @@ namespace MMMEngine {
 		m_renderCommands.clear();
 	}
 
+	size_t RenderManager::GetCommandCount(RenderType _type) const
+	{
+		auto it = m_renderCommands.find(_type);
+		return it != m_renderCommands.end() ? it->second.size() : 0;
+	}
+
 	void RenderManager::BeginFrame()
 	{
+		MMM_PROFILE_SCOPE("RenderManager::BeginFrame");
 		// Clear
-		m_pDeviceContext->ClearRenderTargetView(m_pRenderTargetView.Get(), m_backColor);
-		m_pDeviceContext->ClearDepthStencilView(m_pDepthStencilView.Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+		if (!m_isHeadless) {
+			m_pDeviceContext->ClearRenderTargetView(m_pRenderTargetView.Get(), m_backColor);
+			m_pDeviceContext->ClearDepthStencilView(m_pDepthStencilView.Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+		}
 
 		// TODO :: 글로벌 쉐이더인포 삭제하기 (라이트는 관리했는데 스카이박스 데이터는 관리안함 바꾸셈)
 		ShaderInfo::Get().ClearWorldPropertyDatas();
 
 		// 렌더러 컨트롤
-		InitRenderers();
-		UpdateRenderers();
-		UpdateLights();
+		{
+			MMM_PROFILE_SCOPE("RenderManager::UpdateRenderers");
+			InitRenderers();
+			UpdateRenderers();
+			UpdateLights();
+		}
+
+		// 트랜스폼 일괄계산, 업로드
+		{
+			MMM_PROFILE_SCOPE("RenderManager::UploadTransforms");
+			UploadTransforms();
+		}
 
 		// 카메라 유효성 확인
 		//if(!m_pMainCamera.IsValid())
@@ -610,6 +786,13 @@ namespace MMMEngine {
 
 	void RenderManager::Render()
 	{
+		MMM_PROFILE_SCOPE("RenderManager::Render");
+		// 헤드리스: 디바이스 상태설정 없이 커맨드 정렬, 실행만
+		if (m_isHeadless) {
+			ExcuteCommands();
+			return;
+		}
+
 		if (!m_pMainCamera.IsValid())
 		{
 			// Clear
@@ -706,6 +889,11 @@ namespace MMMEngine {
 
 	void RenderManager::RenderOnlyRenderer()
 	{
+		if (m_isHeadless) {
+			ExcuteCommands();
+			return;
+		}
+
 		// 캠 버퍼 업데이트
 		Render_CamBuffer m_camMat = {};
 		m_camMat.camPos = XMMatrixInverse(nullptr, m_viewMatrix).r[3];
@@ -733,7 +921,7 @@ namespace MMMEngine {
 
 	void RenderManager::RenderPickingIds(ID3D11VertexShader* vs, ID3D11PixelShader* ps, ID3D11InputLayout* layout, ID3D11Buffer* idBuffer)
 	{
-		if (!vs || !ps || !layout || !idBuffer)
+		if (!vs || !ps || !layout || !idBuffer || m_isHeadless)
 			return;
 
 		// 캠 버퍼 업데이트
@@ -750,7 +938,6 @@ namespace MMMEngine {
 		m_pDeviceContext->VSSetShader(vs, nullptr, 0);
 		m_pDeviceContext->PSSetShader(ps, nullptr, 0);
 		m_pDeviceContext->VSSetConstantBuffers(0, 1, m_pCambuffer.GetAddressOf());
-		m_pDeviceContext->VSSetConstantBuffers(1, 1, m_pTransbuffer.GetAddressOf());
 		m_pDeviceContext->PSSetConstantBuffers(5, 1, &idBuffer);
 		float blendFactor[4] = { 0,0,0,0 };
 		UINT sampleMask = 0xffffffff;
@@ -779,10 +966,7 @@ namespace MMMEngine {
 				m_pDeviceContext->IASetVertexBuffers(0, 1, &cmd.vertexBuffer, &stride, &offset);
 				m_pDeviceContext->IASetIndexBuffer(cmd.indexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
-				Render_TransformBuffer transformBuffer;
-				transformBuffer.mWorld = XMMatrixTranspose(m_objWorldMatMap[cmd.worldMatIndex]);
-				transformBuffer.mNormalMatrix = XMMatrixInverse(nullptr, m_objWorldMatMap[cmd.worldMatIndex]);
-				m_pDeviceContext->UpdateSubresource1(m_pTransbuffer.Get(), 0, nullptr, &transformBuffer, 0, 0, D3D11_COPY_DISCARD);
+				BindTransformSlot(cmd.worldMatIndex);
 
 				pickData.objectId = cmd.rendererID + 1;
 				m_pDeviceContext->UpdateSubresource1(idBuffer, 0, nullptr, &pickData, 0, 0, D3D11_COPY_DISCARD);
@@ -794,7 +978,7 @@ namespace MMMEngine {
 
 	void RenderManager::RenderSelectedMask(ID3D11VertexShader* vs, ID3D11PixelShader* ps, ID3D11InputLayout* layout, const uint32_t* ids, uint32_t count)
 	{
-		if (!vs || !ps || !layout || !ids || count == 0)
+		if (!vs || !ps || !layout || !ids || count == 0 || m_isHeadless)
 			return;
 
 		Render_CamBuffer m_camMat = {};
@@ -809,7 +993,6 @@ namespace MMMEngine {
 		m_pDeviceContext->VSSetShader(vs, nullptr, 0);
 		m_pDeviceContext->PSSetShader(ps, nullptr, 0);
 		m_pDeviceContext->VSSetConstantBuffers(0, 1, m_pCambuffer.GetAddressOf());
-		m_pDeviceContext->VSSetConstantBuffers(1, 1, m_pTransbuffer.GetAddressOf());
 		// State (blend/depth/raster) is expected to be set by caller.
 
 		auto isSelected = [ids, count](uint32_t id) -> bool
@@ -837,10 +1020,7 @@ namespace MMMEngine {
 				m_pDeviceContext->IASetVertexBuffers(0, 1, &cmd.vertexBuffer, &stride, &offset);
 				m_pDeviceContext->IASetIndexBuffer(cmd.indexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
-				Render_TransformBuffer transformBuffer;
-				transformBuffer.mWorld = XMMatrixTranspose(m_objWorldMatMap[cmd.worldMatIndex]);
-				transformBuffer.mNormalMatrix = XMMatrixInverse(nullptr, m_objWorldMatMap[cmd.worldMatIndex]);
-				m_pDeviceContext->UpdateSubresource1(m_pTransbuffer.Get(), 0, nullptr, &transformBuffer, 0, 0, D3D11_COPY_DISCARD);
+				BindTransformSlot(cmd.worldMatIndex);
 
 				m_pDeviceContext->DrawIndexed(cmd.indiciesSize, 0, 0);
 			}
@@ -849,11 +1029,13 @@ namespace MMMEngine {
 
 	void RenderManager::EndFrame()
 	{
+		MMM_PROFILE_SCOPE("RenderManager::EndFrame");
 		// 캐싱된 데이터들 해제
 		InitCache();
 
 		// Present our back buffer to our front buffer
-		m_pSwapChain->Present(m_rSyncInterval, 0);
+		if (!m_isHeadless)
+			m_pSwapChain->Present(m_rSyncInterval, 0);
 	}
 
 	uint32_t RenderManager::AddRenderer(Renderer* _renderer)
@@ -6,6 +6,7 @@
 #include "Export.h"
 #include "ExportSingleton.hpp"
 #include <map>
+#include <array>
 #include <vector>
 #include <memory>
 #include <type_traits>
@@ -18,6 +19,7 @@
 
 #include <Object.h>
 #include <RenderCommand.h>
+#include <RenderBackend.h>
 #include <Light.h>
 
 #pragma comment (lib, "d3d11.lib")
@@ -28,6 +30,21 @@ namespace MMMEngine
 	class Material;
 	class Camera;
 	class Renderer;
+
+	// 워커 스레드별 렌더커맨드 버퍼 (worldMatIndex 는 이 버퍼 안의 로컬 인덱스)
+	struct RenderCommandList
+	{
+		std::array<std::vector<RenderCommand>, RenderType::R_END> commands;
+		std::vector<DirectX::SimpleMath::Matrix> worldMats;
+
+		void Clear()
+		{
+			for (auto& list : commands)
+				list.clear();
+			worldMats.clear();
+		}
+	};
+
 	class MMMENGINE_API RenderManager : public Utility::ExportSingleton<RenderManager>
 	{
 		friend class Utility::ExportSingleton<RenderManager>;
@@ -36,14 +53,20 @@ namespace MMMEngine
 		RenderManager();
 
 		bool useBackBuffer = false;
+		bool m_isHeadless = false;		// 널 백엔드 (HWND, 디바이스 없음)
 		DirectX::SimpleMath::Matrix m_worldMatrix;
 		DirectX::SimpleMath::Matrix m_viewMatrix;
 		DirectX::SimpleMath::Matrix m_projMatrix;
 
 		// 렌더러 저장
 		std::map<RenderType, std::vector<RenderCommand>> m_renderCommands;
-		std::unordered_map<int, DirectX::SimpleMath::Matrix> m_objWorldMatMap;
+		std::vector<DirectX::SimpleMath::Matrix> m_objWorldMats;			// 이번 프레임 월드매트릭스 (AddMatrix 인덱스 순)
+		std::vector<DirectX::SimpleMath::Matrix> m_cachedWorldMats;		// 슬롯별 마지막 변환 입력 (변경 검사용)
+		std::vector<Render_TransformSlot> m_transformSlots;				// 전치/노멀행렬이 계산된 슬롯 (프레임간 유지)
 		std::vector<Renderer*> m_renderers;
+		std::vector<Renderer*> m_parallelRenderers;						// 이번 프레임 워커에서 돌릴 렌더러
+		std::vector<RenderCommandList> m_commandLists;					// 청크별 커맨드/매트릭스 버퍼 (청크 순서대로 병합)
+		size_t m_parallelRenderThreshold = 256;							// 이 개수 이상일때만 병렬 생성
 		std::unordered_map<uint32_t, Renderer*> m_rendererIdMap;
 		std::queue<Renderer*> m_renInitQueue;
 		unsigned int m_rObjIdx = 0;
@@ -55,18 +78,37 @@ namespace MMMEngine
 		// 스카이박스 메테리얼 참조
 		std::weak_ptr<Material> m_pSkyboxMaterial;
 
-		void ApplyMatToContext(ID3D11DeviceContext4* _context, Material* _material);
+		// 중복 바인딩 방지용 상태 캐시 (ExcuteCommands 시작마다 초기화)
+		struct StateCache
+		{
+			ID3D11VertexShader* vs = nullptr;
+			ID3D11PixelShader* ps = nullptr;
+			ID3D11InputLayout* layout = nullptr;
+			ID3D11SamplerState* sampler = nullptr;
+			ID3D11Buffer* vertexBuffer = nullptr;
+			ID3D11Buffer* indexBuffer = nullptr;
+			std::array<ID3D11Buffer*, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT> psCBuffers{};
+			std::array<ID3D11ShaderResourceView*, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT> psSRVs{};
+		};
+		StateCache m_stateCache;
+		uint32_t m_skippedBinds = 0;	// 이번 프레임에 생략된 바인딩 수
+
+		void ResetStateCache();
+		void ApplyMatToContext(Material* _material);
+		void UploadTransforms();
+		void BindTransformSlot(int _worldMatIndex);
 		void ExcuteCommands();
 		void InitCache();
 
 		void InitRenderers();
 		void UpdateRenderers();
+		void MergeCommandLists();
 		void UpdateLights();
 
 		void InitD3D();
+		void DrawCommand(const RenderCommand& _cmd);
 		void Start();
 
-		void UpdateProperty(const std::wstring& _propName, const PropertyValue& _value, ShaderType _type);
 	protected:
 		HWND m_hWnd;
 
@@ -108,8 +150,8 @@ namespace MMMEngine
 		// 버퍼 기본색상
 		DirectX::SimpleMath::Vector4 m_ClearColor;
 
-		// 트랜스폼 버퍼
-		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pTransbuffer = nullptr;		// 캠 버퍼
+		// 커맨드 실행 백엔드 (트랜스폼 슬롯 버퍼 소유)
+		std::unique_ptr<RenderBackend> m_pBackend;
 
 		// 카메라 관련
 		ObjPtr<Camera> m_pMainCamera;	// 메인 카메라 참조
@@ -117,6 +159,8 @@ namespace MMMEngine
 
 	public:
 		void StartUp(HWND _hwnd, UINT _ClientWidth, UINT _ClientHeight);
+		// 디바이스 없이 널 백엔드로 시작 (렌더러 등록, 커맨드 생성/정렬/실행 경로만 동작)
+		void StartUpHeadless(UINT _ClientWidth, UINT _ClientHeight);
 		void ShutDown();
 
 		// 이 3개는 업데이트때마다 호출해서 관리할것
@@ -163,5 +207,15 @@ namespace MMMEngine
 		const Microsoft::WRL::ComPtr<ID3D11DeviceContext4> GetContext() const { return m_pDeviceContext; }
 
 		Renderer* GetRendererById(uint32_t id) const;
+		uint32_t GetSkippedBindCount() const { return m_skippedBinds; }
+		// 이번 프레임에 쌓인 렌더커맨드 수 (BeginFrame에서 갱신, 다음 BeginFrame까지 유지)
+		size_t GetCommandCount(RenderType _type) const;
+
+		bool IsHeadless() const { return m_isHeadless; }
+		RenderBackend* GetBackend() const { return m_pBackend.get(); }
+
+		// 렌더러 수가 이 값 이상이면 커맨드 생성을 JobSystem 워커로 분배
+		void SetParallelRenderThreshold(size_t _threshold) { m_parallelRenderThreshold = _threshold; }
+		size_t GetParallelRenderThreshold() const { return m_parallelRenderThreshold; }
 	};
 }
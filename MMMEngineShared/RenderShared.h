@@ -40,6 +40,17 @@ namespace MMMEngine {
 		DirectX::SimpleMath::Matrix mNormalMatrix;
 	};
 
+	// 트랜스폼 슬롯 (VSSetConstantBuffers1 오프셋 바인딩 단위인 256byte로 패딩)
+	struct Render_TransformSlot
+	{
+		Render_TransformBuffer buffer;
+		DirectX::SimpleMath::Vector4 padding[8];
+	};
+	static_assert(sizeof(Render_TransformSlot) == 256, "Render_TransformSlot must be 256 bytes");
+
+	// 슬롯 하나가 차지하는 상수 개수 (16byte 단위)
+	constexpr UINT TRANSFORM_SLOT_CONSTANTS = sizeof(Render_TransformSlot) / 16;
+
 	struct Mesh_Vertex
 	{
 		DirectX::SimpleMath::Vector3 Pos;		// 정점 위치 정보
@@ -69,4 +80,33 @@ namespace MMMEngine {
 		std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>> vertexBuffers;	// 버텍스 버퍼 (idx 메시그룹
 		std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>> indexBuffers;		// 인덱스 버퍼
 	};
+
+	// 메모리 리포트용 크기 계산
+	inline size_t GetMeshDataBytes(const MeshData& _data)
+	{
+		size_t bytes = 0;
+		for (const auto& vertices : _data.vertices)
+			bytes += vertices.capacity() * sizeof(Mesh_Vertex);
+		for (const auto& indices : _data.indices)
+			bytes += indices.capacity() * sizeof(UINT);
+		return bytes;
+	}
+
+	inline size_t GetMeshGPUBytes(const MeshGPU& _gpu)
+	{
+		size_t bytes = 0;
+		auto addBuffers = [&bytes](const std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>>& _buffers)
+			{
+				for (const auto& buffer : _buffers)
+				{
+					if (!buffer) continue;
+					D3D11_BUFFER_DESC desc{};
+					buffer->GetDesc(&desc);
+					bytes += desc.ByteWidth;
+				}
+			};
+		addBuffers(_gpu.vertexBuffers);
+		addBuffers(_gpu.indexBuffers);
+		return bytes;
+	}
 }
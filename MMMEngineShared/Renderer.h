@@ -15,6 +15,12 @@ namespace MMMEngine {
 
 		virtual void Render() {}
 		virtual void Init() {}
+
+		// true면 Render()가 워커 스레드에서 호출될 수 있음
+		// (AddCommand / AddMatrix 외의 공유상태를 건드리면 안됨, 기본은 메인스레드 실행)
+		virtual bool IsParallelRenderable() const { return false; }
+		// 병렬 Render() 직전 메인스레드에서 호출 (지연 계산되는 캐시를 미리 채워두는 용도)
+		virtual void PrepareRender() {}
 		virtual ~Renderer() {}
 
 	public:
@@ -1,5 +1,6 @@
 #include "RendererTools.h"
 #include <d3dcompiler.h>
+#include <cstring>
 
 #pragma comment(lib, "d3dcompiler.lib")
 
@@ -35,3 +36,62 @@ HRESULT MMMEngine::CompileShaderFromFile(const WCHAR* szFileName, LPCSTR szEntry
 
 	return S_OK;
 }
+
+size_t MMMEngine::BatchTransformSlots(
+	const DirectX::SimpleMath::Matrix* _worlds,
+	DirectX::SimpleMath::Matrix* _cachedWorlds,
+	Render_TransformSlot* _slots,
+	size_t _count,
+	size_t _cachedCount)
+{
+	using namespace DirectX;
+
+	size_t computed = 0;
+	for (size_t i = 0; i < _count; ++i)
+	{
+		// 지난번과 같은 입력이면 슬롯 재사용
+		if (i < _cachedCount && memcmp(&_worlds[i], &_cachedWorlds[i], sizeof(XMFLOAT4X4)) == 0)
+			continue;
+
+		XMMATRIX world = XMLoadFloat4x4(&_worlds[i]);
+
+		// 아핀 역행렬 : 3x3 부분은 여인수(외적)로, 이동은 -t * A^-1
+		XMVECTOR r0 = world.r[0];
+		XMVECTOR r1 = world.r[1];
+		XMVECTOR r2 = world.r[2];
+		XMVECTOR c0 = XMVector3Cross(r1, r2);
+		XMVECTOR c1 = XMVector3Cross(r2, r0);
+		XMVECTOR c2 = XMVector3Cross(r0, r1);
+		XMVECTOR det = XMVector3Dot(r0, c0);
+
+		XMMATRIX inv;
+		if (XMVector3NearEqual(det, XMVectorZero(), XMVectorReplicate(1e-12f)))
+		{
+			// 특이행렬은 기존 일반 역행렬 경로 유지
+			inv = XMMatrixInverse(nullptr, world);
+		}
+		else
+		{
+			XMVECTOR invDet = XMVectorReciprocal(det);
+			XMMATRIX cof(
+				XMVectorAndInt(XMVectorMultiply(c0, invDet), g_XMMask3),
+				XMVectorAndInt(XMVectorMultiply(c1, invDet), g_XMMask3),
+				XMVectorAndInt(XMVectorMultiply(c2, invDet), g_XMMask3),
+				g_XMIdentityR3);
+			inv = XMMatrixTranspose(cof);
+
+			XMVECTOR t = world.r[3];
+			XMVECTOR invT = XMVectorMultiply(XMVectorSplatX(t), inv.r[0]);
+			invT = XMVectorMultiplyAdd(XMVectorSplatY(t), inv.r[1], invT);
+			invT = XMVectorMultiplyAdd(XMVectorSplatZ(t), inv.r[2], invT);
+			inv.r[3] = XMVectorSelect(g_XMIdentityR3, XMVectorNegate(invT), g_XMSelect1110);
+		}
+
+		XMStoreFloat4x4(&_slots[i].buffer.mWorld, XMMatrixTranspose(world));
+		XMStoreFloat4x4(&_slots[i].buffer.mNormalMatrix, inv);
+		_cachedWorlds[i] = _worlds[i];
+		++computed;
+	}
+
+	return computed;
+}
@@ -11,9 +11,22 @@
 #include <vector>
 #include <SimpleMath.h>
 
+#include "Export.h"
+#include "RenderShared.h"
+
 namespace MMMEngine {
 	HRESULT CompileShaderFromFile(const WCHAR* szFileName, LPCSTR szEntryPoint, LPCSTR szShaderModel, ID3DBlob** ppBlobOut);
 
+	// 월드행렬 배열을 셰이더용 트랜스폼 슬롯(전치 월드, 노멀행렬)으로 일괄 변환
+	// _cachedWorlds 에는 슬롯별 마지막 입력이 남아있어 같은 행렬이면 계산을 건너뜀 (앞의 _cachedCount 개만 유효)
+	// 반환값 : 실제로 다시 계산된 슬롯 수
+	MMMENGINE_API size_t BatchTransformSlots(
+		const DirectX::SimpleMath::Matrix* _worlds,
+		DirectX::SimpleMath::Matrix* _cachedWorlds,
+		Render_TransformSlot* _slots,
+		size_t _count,
+		size_t _cachedCount);
+
 	class com_exception : public std::exception
 	{
 	public:
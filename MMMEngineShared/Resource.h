@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 #include "Export.h"
 #include "MUID.h"
 #include "rttr/type"
@@ -27,5 +27,8 @@ namespace MMMEngine
 
 		const std::wstring& GetFilePath() const;
 		const Utility::MUID& GetMUID() const;
+
+		// CPU + GPU 메모리 사용량 추정 (메모리 리포트용, 모르는 리소스는 0)
+		virtual size_t GetMemoryUsage() const { return 0; }
 	};
 }
\ No newline at end of file
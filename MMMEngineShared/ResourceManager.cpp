@@ -1,3 +1,28 @@
-#include "ResourceManager.h"
+﻿#include "ResourceManager.h"
+#include <algorithm>
 
-DEFINE_SINGLETON(MMMEngine::ResourceManager)
\ No newline at end of file
+DEFINE_SINGLETON(MMMEngine::ResourceManager)
+
+void MMMEngine::ResourceManager::CollectMemoryStats(std::vector<ResourceMemoryStats>& _out) const
+{
+	_out.clear();
+
+	std::unordered_map<std::string, size_t> indexByType;
+	for (const auto& [key, weak] : m_cache)
+	{
+		auto res = weak.lock();
+		if (!res) continue;
+
+		// 같은 리소스가 다른 키로 두번 들어있는 경우는 없다고 가정 (타입 + 경로가 키)
+		auto [it, inserted] = indexByType.emplace(key.typeName, _out.size());
+		if (inserted)
+			_out.push_back({ key.typeName, 0, 0 });
+
+		ResourceMemoryStats& stats = _out[it->second];
+		++stats.count;
+		stats.bytes += res->GetMemoryUsage();
+	}
+
+	std::sort(_out.begin(), _out.end(),
+		[](const ResourceMemoryStats& a, const ResourceMemoryStats& b) { return a.bytes > b.bytes; });
+}
@@ -10,6 +10,7 @@
 
 #include "MUID.h"
 #include "ExportSingleton.hpp"
+#include "MemoryTracker.h"
 
 #include "Resource.h"
 // todo 삭제
@@ -55,6 +56,19 @@ namespace MMMEngine
 
 		void ClearCache() { m_cache.clear(); }
 
+		// 캐시 항목 중 아직 살아있는 리소스 수 (만료된 weak_ptr 항목은 제외)
+		size_t GetCachedResourceCount() const
+		{
+			size_t count = 0;
+			for (const auto& [key, res] : m_cache)
+				if (!res.expired()) ++count;
+			return count;
+		}
+		size_t GetCacheEntryCount() const { return m_cache.size(); }
+
+		// 살아있는 캐시 리소스를 rttr 타입 이름별로 묶어서 개수/추정 바이트 집계 (바이트 내림차순)
+		void CollectMemoryStats(std::vector<ResourceMemoryStats>& _out) const;
+
 		void StartUp(std::wstring rootPath)
 		{
 			m_rootPath = rootPath;
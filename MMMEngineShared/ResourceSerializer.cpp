@@ -145,6 +145,97 @@ json SerializeMeshGroup(const std::unordered_map<UINT, std::vector<UINT>>& meshG
 	return out;
 }
 
+// "Mesh" 항목 -> MeshData (StaticMesh 역직렬화, 콜라이더 쿠킹 입력 재로드에서 같이 씀)
+void DeserializeMeshData(const json& meshJson, MeshData& meshData)
+{
+	// Vertices 복원
+	if (meshJson.contains("Vertices")) {
+		for (auto& subMeshJson : meshJson.at("Vertices")) {
+			std::vector<Mesh_Vertex> subMesh;
+			for (auto& vertJson : subMeshJson) {
+				Mesh_Vertex vertex;
+
+				// RTTR 파싱
+				//type vertType = type::get<Mesh_Vertex>();
+				//for (auto& prop : vertType.get_properties()) {
+				//	if (prop.is_readonly())
+				//		continue;
+
+				//	std::string name = prop.get_name().to_string();
+				//	if (!vertJson.contains(name))
+				//		continue;
+
+				//	auto& jval = vertJson[name];
+				//	rttr::variant newVal;
+
+				//	// 숫자/문자/배열 처리
+				//	if (jval.is_number_integer())
+				//		newVal = jval.get<int>();
+				//	else if (jval.is_number_float())
+				//		newVal = jval.get<float>();
+				//	else if (jval.is_string())
+				//		newVal = jval.get<std::string>();
+				//	else if (jval.is_array() && jval.size() == 3) {
+				//		DirectX::SimpleMath::Vector3 vec;
+				//		vec.x = jval[0].get<float>();
+				//		vec.y = jval[1].get<float>();
+				//		vec.z = jval[2].get<float>();
+				//		newVal = vec;
+				//	}
+				//	else if (jval.is_array() && jval.size() == 2) {
+				//		DirectX::SimpleMath::Vector2 vec;
+				//		vec.x = jval[0].get<float>();
+				//		vec.y = jval[1].get<float>();
+				//		newVal = vec;
+				//	}
+				//	else if (jval.is_array()) {
+				//		std::vector<int> arr;
+				//		for (auto& elem : jval)
+				//			arr.push_back(elem.get<int>());
+				//		newVal = arr;
+				//	}
+
+				//	if (newVal.is_valid())
+				//		prop.set_value(vertex, newVal);
+				//}
+
+				// 직접 파싱
+				vertex.Pos = { vertJson.at("Pos")[0], vertJson.at("Pos")[1], vertJson.at("Pos")[2] };
+				vertex.Normal = { vertJson.at("Normal")[0], vertJson.at("Normal")[1], vertJson.at("Normal")[2] };
+				vertex.Tangent = { vertJson.at("Tangent")[0], vertJson.at("Tangent")[1], vertJson.at("Tangent")[2] };
+				vertex.UV = { vertJson.at("UV")[0], vertJson.at("UV")[1] };
+				subMesh.push_back(vertex);
+			}
+			meshData.vertices.push_back(subMesh);
+		}
+	}
+
+	// Indices 복원
+	if (meshJson.contains("Indices")) {
+		for (auto& iSubMeshJson : meshJson.at("Indices")) {
+			std::vector<UINT> indices;
+			for (auto& elem : iSubMeshJson) {
+				indices.push_back(elem.get<UINT>());
+			}
+			meshData.indices.push_back(indices);
+		}
+	}
+}
+
+json ReadStaticMeshSnapshot(const std::wstring& _path)
+{
+	std::ifstream file(_path, std::ios::binary | std::ios::ate);
+	auto size = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	std::vector<char> buffer(size);
+	file.read(buffer.data(), size);
+	file.close();
+
+	// msgpack → json 변환
+	return json::from_msgpack(buffer);
+}
+
 fs::path MMMEngine::ResourceSerializer::Serialize_StaticMesh(const StaticMesh* _in, std::wstring _path, std::wstring _name)
 {
 	json snapshot;
@@ -171,6 +262,10 @@ fs::path MMMEngine::ResourceSerializer::Serialize_StaticMesh(const StaticMesh* _
 	meshgroupJson.push_back(SerializeMeshGroup(_in->meshGroupData));
 	snapshot["MeshGroup"] = meshgroupJson;
 
+	// 메시 콜라이더 쿠킹 캐시 키 (로드때마다 해시를 다시 계산하지 않게 저장)
+	if (_in->collisionHash != 0)
+		snapshot["CollisionHash"] = _in->collisionHash;
+
 	// Json 출력
 	std::vector<uint8_t> v = json::to_msgpack(snapshot);
 
@@ -209,16 +304,7 @@ void MMMEngine::ResourceSerializer::DeSerialize_StaticMesh(StaticMesh* _out, std
 	//// 파일 전체 읽기
 	//std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
 	//	std::istreambuf_iterator<char>());
-	std::ifstream file(_path, std::ios::binary | std::ios::ate);
-	auto size = file.tellg();
-	file.seekg(0, std::ios::beg);
-
-	std::vector<char> buffer(size);
-	file.read(buffer.data(), size);
-	file.close();
-
-	// msgpack → json 변환
-	json snapshot = json::from_msgpack(buffer);
+	json snapshot = ReadStaticMeshSnapshot(_path);
 
 	// MUID 복원 ( 아직 안씀)
 	/*if (snapshot.contains("MUID"))
@@ -253,84 +339,15 @@ void MMMEngine::ResourceSerializer::DeSerialize_StaticMesh(StaticMesh* _out, std
 		if (!meshJsonArr.empty()) {
 			auto& meshJson = meshJsonArr[0];
 			MeshData meshData;
-
-			// Vertices 복원
-			if (meshJson.contains("Vertices")) {
-				for (auto& subMeshJson : meshJson["Vertices"]) {
-					std::vector<Mesh_Vertex> subMesh;
-					for (auto& vertJson : subMeshJson) {
-						Mesh_Vertex vertex;
-
-						// RTTR 파싱
-						//type vertType = type::get<Mesh_Vertex>();
-						//for (auto& prop : vertType.get_properties()) {
-						//	if (prop.is_readonly())
-						//		continue;
-
-						//	std::string name = prop.get_name().to_string();
-						//	if (!vertJson.contains(name))
-						//		continue;
-
-						//	auto& jval = vertJson[name];
-						//	rttr::variant newVal;
-
-						//	// 숫자/문자/배열 처리
-						//	if (jval.is_number_integer())
-						//		newVal = jval.get<int>();
-						//	else if (jval.is_number_float())
-						//		newVal = jval.get<float>();
-						//	else if (jval.is_string())
-						//		newVal = jval.get<std::string>();
-						//	else if (jval.is_array() && jval.size() == 3) {
-						//		DirectX::SimpleMath::Vector3 vec;
-						//		vec.x = jval[0].get<float>();
-						//		vec.y = jval[1].get<float>();
-						//		vec.z = jval[2].get<float>();
-						//		newVal = vec;
-						//	}
-						//	else if (jval.is_array() && jval.size() == 2) {
-						//		DirectX::SimpleMath::Vector2 vec;
-						//		vec.x = jval[0].get<float>();
-						//		vec.y = jval[1].get<float>();
-						//		newVal = vec;
-						//	}
-						//	else if (jval.is_array()) {
-						//		std::vector<int> arr;
-						//		for (auto& elem : jval)
-						//			arr.push_back(elem.get<int>());
-						//		newVal = arr;
-						//	}
-
-						//	if (newVal.is_valid())
-						//		prop.set_value(vertex, newVal);
-						//}
-
-						// 직접 파싱
-						vertex.Pos = { vertJson["Pos"][0], vertJson["Pos"][1], vertJson["Pos"][2] };
-						vertex.Normal = { vertJson["Normal"][0], vertJson["Normal"][1], vertJson["Normal"][2] };
-						vertex.Tangent = { vertJson["Tangent"][0], vertJson["Tangent"][1], vertJson["Tangent"][2] };
-						vertex.UV = { vertJson["UV"][0], vertJson["UV"][1] };
-						subMesh.push_back(vertex);
-					}
-					meshData.vertices.push_back(subMesh);
-				}
-			}
-
-			// Indices 복원
-			if (meshJson.contains("Indices")) {
-				for (auto& iSubMeshJson : meshJson["Indices"]) {
-					std::vector<UINT> indices;
-					for (auto& elem : iSubMeshJson) {
-						indices.push_back(elem.get<UINT>());
-					}
-					meshData.indices.push_back(indices);
-				}
-			}
-
+			DeserializeMeshData(meshJson, meshData);
 			_out->meshData = std::move(meshData);
 		}
 	}
 
+	// 이전에 임포트된 에셋은 없음 (0이면 콜라이더가 처음 요청할 때 계산)
+	if (snapshot.contains("CollisionHash"))
+		_out->collisionHash = snapshot["CollisionHash"].get<uint64_t>();
+
 
 	// MeshGroup 복원
 	if (snapshot.contains("MeshGroup"))
@@ -348,3 +365,17 @@ void MMMEngine::ResourceSerializer::DeSerialize_StaticMesh(StaticMesh* _out, std
 		}
 	}
 }
+
+bool MMMEngine::ResourceSerializer::DeSerialize_StaticMeshData(MeshData& _out, std::wstring _path)
+{
+	if (!fs::exists(_path))
+		return false;
+
+	json snapshot = ReadStaticMeshSnapshot(_path);
+	if (!snapshot.contains("Mesh") || snapshot["Mesh"].empty())
+		return false;
+
+	_out = MeshData{};
+	DeserializeMeshData(snapshot["Mesh"][0], _out);
+	return !_out.vertices.empty();
+}
@@ -5,11 +5,14 @@
 
 namespace MMMEngine {
 	class StaticMesh;
+	struct MeshData;
 	class MMMENGINE_API ResourceSerializer : public Utility::ExportSingleton<ResourceSerializer>
 	{
 	public:
 		//TODO::ϵ ̸ ϰϱ
 		std::filesystem::path Serialize_StaticMesh(const StaticMesh* _in, std::wstring _path, std::wstring _name);		// Path
 		void DeSerialize_StaticMesh(StaticMesh* _out, std::wstring _path);			// ԷPath
+		// ޽ ͸ ٽ  (Ƽ/GPU  , ݶ̴ ŷ Է¿) //н false
+		bool DeSerialize_StaticMeshData(MeshData& _out, std::wstring _path);
 	};
 }
@@ -111,6 +111,7 @@ void MMMEngine::RigidBodyComponent::CreateActor(physx::PxPhysics* physics, Vecto
 
 	MarkMassDirty();
 	SyncInterpolationPose(worldPos, Quater);
+	MarkTransformSynced();
 
 	m_Actor->userData = this;
 }
@@ -226,7 +227,12 @@ void MMMEngine::RigidBodyComponent::PullFromPhysics()
 	//}
 
 	// PhysX -> Engine Transform
-	const physx::PxTransform pxPose = t_dynamic->getGlobalPose();
+	PullFromPose(t_dynamic->getGlobalPose());
+}
+
+void MMMEngine::RigidBodyComponent::PullFromPose(const physx::PxTransform& pxPose)
+{
+	if (m_Desc.type == Type::Static) return;
 
 	Vector3 pos = ToVec(pxPose.p);
 	Quaternion rot = ToQuat(pxPose.q);
@@ -244,7 +250,21 @@ void MMMEngine::RigidBodyComponent::PullFromPhysics()
 
 	GetTransform()->SetWorldPosition(pos);
 	GetTransform()->SetWorldRotation(rot);
+	MarkTransformSynced();
+}
+
+bool MMMEngine::RigidBodyComponent::IsTransformChangedSinceSync()
+{
+	auto tr = GetTransform();
+	if (!tr) return false;
+	return tr->GetWorldVersion() != m_SyncedTransformVersion;
+}
 
+void MMMEngine::RigidBodyComponent::MarkTransformSynced()
+{
+	auto tr = GetTransform();
+	if (!tr) return;
+	m_SyncedTransformVersion = tr->GetWorldVersion();
 }
 
 void MMMEngine::RigidBodyComponent::PushPoseIfDirty()
@@ -377,6 +397,7 @@ void MMMEngine::RigidBodyComponent::Editor_changeTrans(const Vector3& worldPos,
 	m_PoseDirty = true;
 	m_WakeRequested = true;
 	SyncInterpolationPose(worldPos, Quater);
+	MarkTransformSynced();
 }
 
 void MMMEngine::RigidBodyComponent::AddForce(Vector3 f, ForceMode mod)
@@ -609,16 +630,7 @@ void MMMEngine::RigidBodyComponent::BindTeleport()
 
 void MMMEngine::RigidBodyComponent::ApplyInterpolation(float alpha)
 {
-	if (m_Desc.interpolation != InterpolationMode::Interpolate)
-		return;
-
-	if (m_Desc.type != Type::Dynamic)
-		return;
-
-	if (m_Desc.isKinematic)
-		return;
-
-	if (!m_InterpInitialized)
+	if (!UsesInterpolation())
 		return;
 
 	auto tr = GetTransform();
@@ -635,6 +647,83 @@ void MMMEngine::RigidBodyComponent::ApplyInterpolation(float alpha)
 	tr->SetWorldRotation(rot);
 }
 
+bool MMMEngine::RigidBodyComponent::UsesInterpolation() const
+{
+	return m_Desc.interpolation == InterpolationMode::Interpolate
+		&& m_Desc.type == Type::Dynamic
+		&& !m_Desc.isKinematic
+		&& m_InterpInitialized;
+}
+
+void MMMEngine::RigidBodyComponent::GetInterpolationPoses(Vector3& prevPos, Quaternion& prevRot, Vector3& currPos, Quaternion& currRot) const
+{
+	prevPos = m_InterpPrev.position;
+	prevRot = m_InterpPrev.rotation;
+	currPos = m_InterpCurr.position;
+	currRot = m_InterpCurr.rotation;
+}
+
+void MMMEngine::RigidBodyComponent::SettleInterpolation()
+{
+	if (!m_InterpInitialized) return;
+
+	m_InterpPrev = m_InterpCurr;
+
+	auto tr = GetTransform();
+	if (!tr) return;
+	tr->SetWorldPosition(m_InterpCurr.position);
+	tr->SetWorldRotation(m_InterpCurr.rotation);
+	MarkTransformSynced();
+}
+
+bool MMMEngine::RigidBodyComponent::CaptureState(StateSnapshot& out) const
+{
+	if (!m_Actor) return false;
+	auto* t_dynamic = m_Actor->is<physx::PxRigidDynamic>();
+	if (!t_dynamic) return false;
+
+	out.pose = t_dynamic->getGlobalPose();
+	const bool kinematic = t_dynamic->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC);
+	out.linearVelocity = kinematic ? physx::PxVec3(0.0f) : t_dynamic->getLinearVelocity();
+	out.angularVelocity = kinematic ? physx::PxVec3(0.0f) : t_dynamic->getAngularVelocity();
+	out.sleeping = t_dynamic->isSleeping();
+	return true;
+}
+
+void MMMEngine::RigidBodyComponent::RestoreState(const StateSnapshot& state)
+{
+	if (!m_Actor) return;
+	auto* t_dynamic = m_Actor->is<physx::PxRigidDynamic>();
+	if (!t_dynamic) return;
+
+	t_dynamic->setGlobalPose(state.pose, false);
+
+	if (!t_dynamic->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC))
+	{
+		t_dynamic->setLinearVelocity(state.linearVelocity, false);
+		t_dynamic->setAngularVelocity(state.angularVelocity, false);
+		if (state.sleeping) t_dynamic->putToSleep();
+		else t_dynamic->wakeUp();
+	}
+
+	//스냅샷 이후에 쌓인 요청은 재시뮬레이션에서 다시 들어옴
+	m_ForceQueue.clear();
+	m_TorqueQueue.clear();
+	m_PoseDirty = false;
+	m_HasKinematicTarget = false;
+	m_WakeRequested = false;
+
+	const Vector3 pos = ToVec(state.pose.p);
+	const Quaternion rot = ToQuat(state.pose.q);
+	SyncInterpolationPose(pos, rot);
+
+	auto tr = GetTransform();
+	if (!tr) return;
+	tr->SetWorldPosition(pos);
+	tr->SetWorldRotation(rot);
+	MarkTransformSynced();
+}
+
 //private 함수들
 physx::PxForceMode::Enum MMMEngine::RigidBodyComponent::ToPxForceMode(ForceMode mode)
 {
@@ -107,11 +107,36 @@ namespace MMMEngine {
 		void PushToPhysics();
 		//simulate이후 getGlobalPose()일어서 m_Tr에 반영하기 위한 함수
 		void PullFromPhysics();
+		//이미 읽어온 pose로 Transform/보간 포즈 갱신 (PhysScene 일괄 Pull용)
+		void PullFromPose(const physx::PxTransform& pxPose);
 		void ApplyInterpolation(float alpha);
+		//보간 적용 대상인지 (Interpolate + Dynamic + 비키네마틱 + 초기화됨)
+		bool UsesInterpolation() const;
+		void GetInterpolationPoses(Vector3& prevPos, Quaternion& prevRot, Vector3& currPos, Quaternion& currRot) const;
+		//더 이상 움직이지 않는 rigid의 보간을 현재 포즈로 고정
+		void SettleInterpolation();
+
+		//롤백용 물리 상태 (dynamic actor만 해당)
+		struct StateSnapshot
+		{
+			physx::PxTransform pose = physx::PxTransform(physx::PxIdentity);
+			physx::PxVec3 linearVelocity = physx::PxVec3(0.0f);
+			physx::PxVec3 angularVelocity = physx::PxVec3(0.0f);
+			bool sleeping = false;
+		};
+		//static이거나 actor가 없으면 false
+		bool CaptureState(StateSnapshot& out) const;
+		//actor 상태를 되돌리고 Transform/보간 포즈도 맞춤 //쌓여있던 힘/텔레포트 요청은 버림
+		void RestoreState(const StateSnapshot& state);
 
 		//좌표를 강제로 바꿨을때 dirty설정 ( 외부적 요인으로 인해 변경했을때만 호출 )
 		void PushPoseIfDirty();
 
+		//마지막 Push/Pull 이후 Transform이 바뀌었는지 (Transform 월드 버전 비교)
+		bool IsTransformChangedSinceSync();
+		//현재 Transform 상태를 물리와 맞춰진 상태로 기록
+		void MarkTransformSynced();
+
 		void PushForces();
 
 		//Dynamic이지만 회전은 즉각 변경하는 로직
@@ -281,5 +306,8 @@ namespace MMMEngine {
 		bool m_ColliderMaster = false;
 
 		bool m_MassDirty = false;
+
+		//마지막으로 물리와 맞춘 시점의 Transform 월드 버전
+		uint32_t m_SyncedTransformVersion = UINT32_MAX;
 	};
 }
@@ -31,6 +31,42 @@ const MMMEngine::SnapShot& MMMEngine::Scene::GetSnapShot() const
     return m_snapshot;
 }
 
+namespace
+{
+    // nlohmann::json Ʈ ũ  (object std::map   )
+    size_t EstimateJsonBytes(const nlohmann::json& j)
+    {
+        constexpr size_t kMapNodeOverhead = 32;
+
+        size_t bytes = sizeof(nlohmann::json);
+        switch (j.type())
+        {
+        case nlohmann::json::value_t::object:
+            for (auto it = j.begin(); it != j.end(); ++it)
+                bytes += kMapNodeOverhead + sizeof(std::string) + it.key().capacity() + EstimateJsonBytes(it.value());
+            break;
+        case nlohmann::json::value_t::array:
+            for (const auto& element : j)
+                bytes += EstimateJsonBytes(element);
+            break;
+        case nlohmann::json::value_t::string:
+            bytes += sizeof(std::string) + j.get_ref<const std::string&>().capacity();
+            break;
+        case nlohmann::json::value_t::binary:
+            bytes += j.get_binary().size();
+            break;
+        default:
+            break;
+        }
+        return bytes;
+    }
+}
+
+size_t MMMEngine::Scene::GetSnapShotMemoryUsage() const
+{
+    return EstimateJsonBytes(m_snapshot);
+}
+
 void MMMEngine::Scene::Clear()
 {
     for (auto& go : m_gameObjects)
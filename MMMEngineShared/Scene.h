@@ -34,6 +34,8 @@ namespace MMMEngine
 		void RegisterGameObject(ObjPtr<GameObject> go);
 		void UnRegisterGameObject(ObjPtr<GameObject> go);
 		const std::string& GetName() const;
+		//  json  ޸ ġ
+		size_t GetSnapShotMemoryUsage() const;
 		const Utility::MUID& GetMUID() const;
 
 		void SetName(const std::string& name);
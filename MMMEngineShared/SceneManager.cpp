@@ -8,11 +8,13 @@
 #include <iostream>
 
 #include "Camera.h"
+#include "Profiler.h"
 
 DEFINE_SINGLETON(MMMEngine::SceneManager)
 
 void MMMEngine::SceneManager::LoadScenes(bool allowEmptyScene)
 {
+	MMM_PROFILE_FUNCTION();
 	//rootPath에서 bin을 읽어서 m_sceneNameToID; // <Name , ID>를 초기화
 	auto sceneListfilePath = m_sceneListPath + L"/sceneList.bin";
 	std::ifstream file(sceneListfilePath, std::ios::binary);
@@ -102,6 +104,16 @@ std::vector<MMMEngine::Scene*> MMMEngine::SceneManager::GetAllSceneToRaw()
 	return rawScenes;
 }
 
+size_t MMMEngine::SceneManager::GetSnapShotMemoryUsage() const
+{
+	size_t bytes = 0;
+	for (const auto& scene : m_scenes)
+		if (scene) bytes += scene->GetSnapShotMemoryUsage();
+	if (m_dontDestroyOnLoadScene)
+		bytes += m_dontDestroyOnLoadScene->GetSnapShotMemoryUsage();
+	return bytes;
+}
+
 const MMMEngine::SceneRef MMMEngine::SceneManager::GetCurrentScene() const
 {
 	return { m_currentSceneID , false };
@@ -311,6 +323,7 @@ bool MMMEngine::SceneManager::CheckSceneIsChanged()
 		m_currentSceneID = m_nextSceneID;
 		m_nextSceneID = static_cast<size_t>(-1);
 
+		MMM_PROFILE_SCOPE("SceneManager::LoadScene");
 		onSceneInitBefore(this);
 		m_scenes[m_currentSceneID]->Initialize();
 		return true;
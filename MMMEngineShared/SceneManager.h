@@ -45,6 +45,8 @@ namespace MMMEngine
 		std::vector<ObjPtr<GameObject>> GetAllGameObjectInDDOL();
 		SceneRef GetSceneRef(const Scene* pScene);
 		std::vector<Scene*> GetAllSceneToRaw();
+		//   ִ json  ޸ ġ 
+		size_t GetSnapShotMemoryUsage() const;
 		Scene* GetCurrentSceneRaw() { return m_scenes[m_currentSceneID].get(); }
 		//=====================================//
 
@@ -1,6 +1,7 @@
 ﻿#include "ShaderInfo.h"
 #include <filesystem>
 #include <d3dcompiler.h>
+#include <algorithm>
 
 #include "RenderManager.h"
 #include "Material.h"
@@ -16,7 +17,7 @@ void MMMEngine::ShaderInfo::CreatePShaderReflection(std::wstring&& _filePath)
 	if (typeIt == m_typeInfoMap.end())
 		throw std::runtime_error("ShaderInfo::CreateShaderReflection : Shader Type not found !!");
 
-	ShaderType _type = typeIt->second.shaderType;
+	ShaderType _type = m_typeInfos[typeIt->second].shaderType;
 
 	// 절대경로 만들기
 	fs::path realPath(ResourceManager::Get().GetCurrentRootPath());
@@ -92,9 +93,10 @@ void MMMEngine::ShaderInfo::StartUp()
 {
 	// --- JSON 템플릿 ---
 	// 쉐이더 타입정보정의
-	m_typeInfoMap[L"Shader/PBR/PS/BRDFShader.hlsl"] = { ShaderType::S_PBR, RenderType::R_GEOMETRY };
-	m_typeInfoMap[L"Shader/SkyBox/SkyBoxPixelShader.hlsl"] = { ShaderType::S_SKYBOX, RenderType::R_SKYBOX };
-	//m_typeInfoMap[L"Shader/SkyBox/SkyBoxPixelShader.hlsl"] = { ShaderType::S_PP, RenderType::R_NONE };
+	++m_typeInfoGeneration;
+	RegisterShaderType(L"Shader/PBR/PS/BRDFShader.hlsl", { ShaderType::S_PBR, RenderType::R_GEOMETRY });
+	RegisterShaderType(L"Shader/SkyBox/SkyBoxPixelShader.hlsl", { ShaderType::S_SKYBOX, RenderType::R_SKYBOX });
+	//RegisterShaderType(L"Shader/SkyBox/SkyBoxPixelShader.hlsl", { ShaderType::S_PP, RenderType::R_NONE });
 
 	// 타입별 레지스터 번호 등록
 	m_propertyInfoMap[ShaderType::S_PBR][L"_albedo"] = { PropertyType::Texture, 0 };
@@ -135,6 +137,9 @@ void MMMEngine::ShaderInfo::StartUp()
 	CreatePShaderReflection(L"Shader/PBR/PS/BRDFShader.hlsl");
 	CreatePShaderReflection(L"Shader/SkyBox/SkyBoxPixelShader.hlsl");
 
+	// 리플렉션 결과로 핸들 테이블 생성
+	BuildPropertyTables();
+
 	// 기본 쉐이더 정의
 	m_pDefaultVShader = ResourceManager::Get().Load<VShader>(L"Shader/PBR/VS/SkeletalVertexShader.hlsl");
 	m_pDefaultPShader = ResourceManager::Get().Load<PShader>(L"Shader/PBR/PS/BRDFShader.hlsl");
@@ -153,9 +158,17 @@ void MMMEngine::ShaderInfo::ShutDown()
 	m_pDefaultPShader.reset();
 
 	m_typeInfoMap.clear();
+	m_typeInfos.clear();
+	++m_typeInfoGeneration;
 	m_propertyInfoMap.clear();
+	for (auto& table : m_flatPropertyTable)
+		table.clear();
+	for (auto& globals : m_flatGlobalProps)
+		globals.clear();
 	m_CBPropertyMap.clear();
 	m_CBBufferMap.clear();
+	m_committedGlobalPropMap.clear();
+	++m_globalVersion;
 }
 
 MMMEngine::ResPtr<MMMEngine::VShader> MMMEngine::ShaderInfo::GetDefaultVShader()
@@ -180,125 +193,205 @@ MMMEngine::ResPtr<MMMEngine::PShader> MMMEngine::ShaderInfo::GetFullScreenPShade
 
 const MMMEngine::RenderType MMMEngine::ShaderInfo::GetRenderType(const std::wstring& _shaderPath)
 {
-	if (m_typeInfoMap.find(_shaderPath) == m_typeInfoMap.end())
+	auto it = m_typeInfoMap.find(_shaderPath);
+	if (it == m_typeInfoMap.end())
 		return RenderType::R_GEOMETRY;
 
-	return m_typeInfoMap[_shaderPath].renderType;
+	return m_typeInfos[it->second].renderType;
 }
 
 const MMMEngine::ShaderType MMMEngine::ShaderInfo::GetShaderType(const std::wstring& _shaderPath)
 {
-	if (m_typeInfoMap.find(_shaderPath) == m_typeInfoMap.end())
+	auto it = m_typeInfoMap.find(_shaderPath);
+	if (it == m_typeInfoMap.end())
 		return ShaderType::S_PBR;
 
-	return m_typeInfoMap[_shaderPath].shaderType;
+	return m_typeInfos[it->second].shaderType;
 }
 
-void MMMEngine::ShaderInfo::UpdateProperty(ID3D11DeviceContext4* context,
-	const ShaderType shaderType,
-	const std::wstring& propertyName,
-	const void* data)
+const MMMEngine::TypeInfo* MMMEngine::ShaderInfo::ResolveTypeInfo(PShader* _shader)
 {
-	// 1. 글로벌 프로퍼티 먼저 확인
-	auto gIt = m_globalPropMap.find(shaderType);
-	if (gIt != m_globalPropMap.end())
+	if (!_shader)
+		return nullptr;
+
+	// 캐시된 핸들이 이번 StartUp 기준이 아니면 경로로 한번만 다시 찾음
+	if (_shader->m_typeHandleGeneration != m_typeInfoGeneration)
 	{
-		auto& gPropMap = gIt->second;
-		auto gPropIt = gPropMap.find(propertyName);
-		if (gPropIt != gPropMap.end())
-		{
-			const PropertyValue& gval = gPropIt->second;
-			const PropertyInfo& pinfo = m_propertyInfoMap[shaderType][propertyName];
+		auto it = m_typeInfoMap.find(_shader->GetFilePath());
+		_shader->m_typeHandle = it == m_typeInfoMap.end() ? -1 : it->second;
+		_shader->m_typeHandleGeneration = m_typeInfoGeneration;
+	}
 
-			if (pinfo.propertyType == PropertyType::Constant)
-			{
-				// 글로벌 ConstantBuffer 값 적용
-				auto cbIt = m_CBPropertyMap[shaderType].find(propertyName);
-				if (cbIt == m_CBPropertyMap[shaderType].end())
-					return;
+	if (_shader->m_typeHandle < 0)
+		return nullptr;
+	return &m_typeInfos[_shader->m_typeHandle];
+}
 
-				const CBPropertyInfo& cbInfo = cbIt->second;
-				auto bufIt = m_CBBufferMap.find(cbInfo.bufferName);
-				if (bufIt == m_CBBufferMap.end())
-					return;
+const MMMEngine::RenderType MMMEngine::ShaderInfo::GetRenderType(PShader* _shader)
+{
+	const TypeInfo* info = ResolveTypeInfo(_shader);
+	return info ? info->renderType : RenderType::R_GEOMETRY;
+}
 
-				auto buffer = bufIt->second;
+const MMMEngine::ShaderType MMMEngine::ShaderInfo::GetShaderType(PShader* _shader)
+{
+	const TypeInfo* info = ResolveTypeInfo(_shader);
+	return info ? info->shaderType : ShaderType::S_PBR;
+}
+
+MMMEngine::PropertyHandle MMMEngine::ShaderInfo::GetPropertyHandle(const std::wstring& _propertyName)
+{
+	auto it = m_propertyHandleMap.find(_propertyName);
+	if (it != m_propertyHandleMap.end())
+		return it->second;
+
+	PropertyHandle handle = static_cast<PropertyHandle>(m_propertyNames.size());
+	m_propertyNames.push_back(_propertyName);
+	m_propertyHandleMap.emplace(_propertyName, handle);
+	return handle;
+}
 
-				D3D11_MAPPED_SUBRESOURCE mapped;
-				if (SUCCEEDED(context->Map(buffer.Get(), 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mapped)))
+const std::wstring& MMMEngine::ShaderInfo::GetPropertyName(PropertyHandle _handle) const
+{
+	static const std::wstring empty;
+	if (_handle < 0 || _handle >= static_cast<PropertyHandle>(m_propertyNames.size()))
+		return empty;
+	return m_propertyNames[_handle];
+}
+
+void MMMEngine::ShaderInfo::RegisterShaderType(const std::wstring& _shaderPath, const TypeInfo& _info)
+{
+	auto it = m_typeInfoMap.find(_shaderPath);
+	if (it != m_typeInfoMap.end())
+	{
+		m_typeInfos[it->second] = _info;
+		return;
+	}
+
+	m_typeInfoMap.emplace(_shaderPath, static_cast<int>(m_typeInfos.size()));
+	m_typeInfos.push_back(_info);
+}
+
+void MMMEngine::ShaderInfo::BuildPropertyTables()
+{
+	for (auto& table : m_flatPropertyTable)
+		table.clear();
+
+	for (auto& [type, props] : m_propertyInfoMap)
+	{
+		auto& table = m_flatPropertyTable[type];
+		auto& buffers = m_typeBufferMap[type];
+
+		for (auto& [propName, pinfo] : props)
+		{
+			PropertyHandle handle = GetPropertyHandle(propName);
+			if (table.size() <= static_cast<size_t>(handle))
+				table.resize(handle + 1);
+
+			FlatPropertyInfo flat;
+			flat.propertyType = pinfo.propertyType;
+			flat.bufferIndex = pinfo.bufferIndex;
+			flat.valid = pinfo.propertyType == PropertyType::Texture;
+
+			if (pinfo.propertyType == PropertyType::Constant)
+			{
+				auto cbIt = m_CBPropertyMap[type].find(propName);
+				if (cbIt != m_CBPropertyMap[type].end())
 				{
-					// gval이 std::variant라면 std::visit으로 꺼내서 memcpy
-					std::visit([&](auto&& arg) {
-						memcpy((BYTE*)mapped.pData + cbInfo.offset, &arg, cbInfo.size);
-						}, gval);
-					context->Unmap(buffer.Get(), 0);
+					flat.offset = cbIt->second.offset;
+					flat.size = cbIt->second.size;
+
+					auto bufIt = m_CBBufferMap.find(cbIt->second.bufferName);
+					if (bufIt != m_CBBufferMap.end())
+						flat.sharedBuffer = bufIt->second.Get();
+
+					for (size_t i = 0; i < buffers.size(); ++i)
+					{
+						if (buffers[i].bufferName == cbIt->second.bufferName)
+						{
+							flat.cbufferIndex = static_cast<int>(i);
+							break;
+						}
+					}
+					flat.valid = flat.sharedBuffer != nullptr;
 				}
-				return;
 			}
-			else if (pinfo.propertyType == PropertyType::Texture)
-			{
-				auto texPtr = std::get<ResPtr<Texture2D>>(gval);
-				if (!texPtr)
-					return;
 
-				ID3D11ShaderResourceView* srv =
-					texPtr->m_pSRV.Get();
-				context->PSSetShaderResources(pinfo.bufferIndex, 1, &srv);
-				return;
-			}
-			else if (pinfo.propertyType == PropertyType::Sampler)
-			{
-				return;
-			}
+			table[handle] = flat;
 		}
 	}
+}
 
-	// 2. 글로벌에 없으면 머티리얼 프로퍼티 업데이트 (기존 로직)
-	auto propIt = m_propertyInfoMap.find(shaderType);
-	if (propIt == m_propertyInfoMap.end())
+void MMMEngine::ShaderInfo::UpdateProperty(ID3D11DeviceContext4* context,
+	const ShaderType shaderType,
+	const std::wstring& propertyName,
+	const void* data)
+{
+	UpdateProperty(context, shaderType, GetPropertyHandle(propertyName), data);
+}
+
+void MMMEngine::ShaderInfo::UpdateProperty(ID3D11DeviceContext4* context,
+	const ShaderType shaderType,
+	const PropertyHandle handle,
+	const void* data)
+{
+	if (shaderType < 0 || shaderType >= ShaderType::S_END)
 		return;
 
-	auto& propMap = propIt->second;
-	auto pinfoIt = propMap.find(propertyName);
-	if (pinfoIt == propMap.end())
+	auto& table = m_flatPropertyTable[shaderType];
+	if (handle < 0 || static_cast<size_t>(handle) >= table.size() || !table[handle].valid)
 		return;
 
-	const PropertyInfo& pinfo = pinfoIt->second;
+	const FlatPropertyInfo& info = table[handle];
 
-	if (pinfo.propertyType == PropertyType::Constant)
+	// 1. 글로벌 프로퍼티 먼저 확인
+	CommitGlobalProps();
+	const PropertyValue* gval = nullptr;
+	for (auto& [gHandle, value] : m_flatGlobalProps[shaderType])
 	{
-		auto cbIt = m_CBPropertyMap[shaderType].find(propertyName);
-		if (cbIt == m_CBPropertyMap[shaderType].end())
-			return;
-
-		const CBPropertyInfo& cbInfo = cbIt->second;
-		auto bufIt = m_CBBufferMap.find(cbInfo.bufferName);
-		if (bufIt == m_CBBufferMap.end())
-			return;
-
-		auto buffer = bufIt->second;
+		if (gHandle == handle)
+		{
+			gval = &value;
+			break;
+		}
+	}
 
+	if (info.propertyType == PropertyType::Constant)
+	{
 		D3D11_MAPPED_SUBRESOURCE mapped;
-		if (SUCCEEDED(context->Map(buffer.Get(), 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mapped)))
+		if (SUCCEEDED(context->Map(info.sharedBuffer, 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mapped)))
 		{
-			memcpy((BYTE*)mapped.pData + cbInfo.offset, data, cbInfo.size);
-			context->Unmap(buffer.Get(), 0);
+			if (gval)
+			{
+				// gval이 std::variant라면 std::visit으로 꺼내서 memcpy
+				std::visit([&](auto&& arg) {
+					using T = std::decay_t<decltype(arg)>;
+					if constexpr (!std::is_same_v<T, ResPtr<Texture2D>>)
+						memcpy((BYTE*)mapped.pData + info.offset, &arg, std::min<size_t>(info.size, sizeof(T)));
+					}, *gval);
+			}
+			else
+			{
+				memcpy((BYTE*)mapped.pData + info.offset, data, info.size);
+			}
+			context->Unmap(info.sharedBuffer, 0);
 		}
 	}
-	else if (pinfo.propertyType == PropertyType::Texture)
+	else if (info.propertyType == PropertyType::Texture)
 	{
 		ID3D11ShaderResourceView* srv =
 			reinterpret_cast<ID3D11ShaderResourceView*>(const_cast<void*>(data));
-		context->PSSetShaderResources(pinfo.bufferIndex, 1, &srv);
-	}
-	else if (pinfo.propertyType == PropertyType::Sampler)
-	{
-		return;
-		/*ID3D11SamplerState* sampler =
-			reinterpret_cast<ID3D11SamplerState*>(const_cast<void*>(data));
-		context->PSSetSamplers(pinfo.bufferIndex, 1, &sampler);*/
-	}
 
+		if (gval)
+		{
+			auto texPtr = std::get_if<ResPtr<Texture2D>>(gval);
+			if (!texPtr || !*texPtr)
+				return;
+			srv = (*texPtr)->m_pSRV.Get();
+		}
+
+		context->PSSetShaderResources(info.bufferIndex, 1, &srv);
+	}
 }
 
 const int MMMEngine::ShaderInfo::PropertyToIdx(const ShaderType _type, const std::wstring& _propertyName, PropertyInfo* _out /*= nullptr*/) const
@@ -337,6 +430,159 @@ void MMMEngine::ShaderInfo::UpdateCBuffers(const ShaderType _type)
 	}
 }
 
+void MMMEngine::ShaderInfo::CommitGlobalProps()
+{
+	if (!m_isGlobalDirty)
+		return;
+	m_isGlobalDirty = false;
+
+	// 라이트처럼 매 프레임 다시 등록되는 값은 실제로 달라졌을때만 재베이크
+	if (m_globalPropMap == m_committedGlobalPropMap)
+		return;
+
+	m_committedGlobalPropMap = m_globalPropMap;
+	++m_globalVersion;
+
+	for (auto& globals : m_flatGlobalProps)
+		globals.clear();
+
+	for (auto& [type, props] : m_committedGlobalPropMap)
+	{
+		for (auto& [prop, val] : props)
+			m_flatGlobalProps[type].emplace_back(GetPropertyHandle(prop), val);
+	}
+}
+
+void MMMEngine::ShaderInfo::WriteBakedProperty(MaterialBinding& _binding, PropertyHandle _handle, const PropertyValue& _value)
+{
+	auto& table = m_flatPropertyTable[_binding.shaderType];
+	if (_handle < 0 || static_cast<size_t>(_handle) >= table.size() || !table[_handle].valid)
+		return;
+
+	const FlatPropertyInfo& info = table[_handle];
+
+	if (info.propertyType == PropertyType::Constant)
+	{
+		if (info.cbufferIndex < 0 || static_cast<size_t>(info.cbufferIndex) >= _binding.cbuffers.size())
+			return;
+
+		auto& baked = _binding.cbuffers[info.cbufferIndex];
+		std::visit([&](auto&& arg)
+			{
+				using T = std::decay_t<decltype(arg)>;
+				if constexpr (!std::is_same_v<T, ResPtr<Texture2D>>)
+				{
+					size_t size = std::min<size_t>(info.size, sizeof(T));
+					if (info.offset + size <= baked.data.size())
+						memcpy(baked.data.data() + info.offset, &arg, size);
+				}
+			}, _value);
+	}
+	else if (info.propertyType == PropertyType::Texture)
+	{
+		auto tex = std::get_if<ResPtr<Texture2D>>(&_value);
+		if (!tex || !*tex)
+			return;
+
+		ID3D11ShaderResourceView* srv = (*tex)->m_pSRV.Get();
+		UINT slot = static_cast<UINT>(info.bufferIndex);
+
+		// 같은 슬롯이면 덮어쓰기 (글로벌 우선)
+		for (auto& [s, view] : _binding.srvs)
+		{
+			if (s == slot)
+			{
+				view = srv;
+				return;
+			}
+		}
+		_binding.srvs.emplace_back(slot, srv);
+	}
+}
+
+const MMMEngine::MaterialBinding& MMMEngine::ShaderInfo::BakeMaterial(ID3D11DeviceContext4* _context, Material* _mat)
+{
+	CommitGlobalProps();
+
+	MaterialBinding& binding = _mat->m_binding;
+	if (binding.materialVersion == _mat->m_version && binding.globalVersion == m_globalVersion)
+		return binding;
+
+	binding.shaderType = GetShaderType(_mat->GetPShader().get());
+
+	// 프로퍼티 이름 -> 핸들 변환은 메테리얼이 바뀔때만
+	if (_mat->m_propertyHandlesVersion != _mat->m_version)
+	{
+		_mat->m_propertyHandles.clear();
+		_mat->m_propertyHandles.reserve(_mat->m_properties.size());
+		for (auto& [prop, val] : _mat->m_properties)
+			_mat->m_propertyHandles.emplace_back(GetPropertyHandle(prop), &val);
+		_mat->m_propertyHandlesVersion = _mat->m_version;
+	}
+
+	// 상수버퍼 블록 준비
+	auto bufIt = m_typeBufferMap.find(binding.shaderType);
+	size_t cbCount = bufIt == m_typeBufferMap.end() ? 0 : bufIt->second.size();
+	if (binding.cbuffers.size() != cbCount)
+		binding.cbuffers.clear();
+	binding.cbuffers.resize(cbCount);
+
+	for (size_t i = 0; i < cbCount; ++i)
+	{
+		const BufferInfo& info = bufIt->second[i];
+		BakedCBuffer& baked = binding.cbuffers[i];
+
+		auto cbit = m_CBBufferMap.find(info.bufferName);
+		if (cbit == m_CBBufferMap.end())
+			continue;
+
+		D3D11_BUFFER_DESC desc;
+		cbit->second->GetDesc(&desc);
+
+		if (baked.bufferName != info.bufferName || baked.data.size() != desc.ByteWidth)
+			baked.buffer.Reset();
+
+		baked.bufferName = info.bufferName;
+		baked.registerIndex = info.registerIndex;
+		baked.data.assign(desc.ByteWidth, 0);
+	}
+	binding.srvs.clear();
+
+	// 메테리얼 값 -> 글로벌 값 순서로 기록 (글로벌 우선)
+	for (auto& [handle, val] : _mat->m_propertyHandles)
+		WriteBakedProperty(binding, handle, *val);
+
+	for (auto& [handle, val] : m_flatGlobalProps[binding.shaderType])
+		WriteBakedProperty(binding, handle, val);
+
+	// GPU 업로드 (헤드리스면 컨텍스트가 없으니 CPU 블록만 유지)
+	for (auto& baked : binding.cbuffers)
+	{
+		if (baked.data.empty() || !_context)
+			continue;
+
+		if (!baked.buffer)
+		{
+			D3D11_BUFFER_DESC bd = {};
+			bd.Usage = D3D11_USAGE_DEFAULT;
+			bd.ByteWidth = static_cast<UINT>(baked.data.size());
+			bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+			D3D11_SUBRESOURCE_DATA init = {};
+			init.pSysMem = baked.data.data();
+			HR_T(RenderManager::Get().GetDevice()->CreateBuffer(&bd, &init, baked.buffer.GetAddressOf()));
+		}
+		else
+		{
+			_context->UpdateSubresource(baked.buffer.Get(), 0, nullptr, baked.data.data(), 0, 0);
+		}
+	}
+
+	binding.materialVersion = _mat->m_version;
+	binding.globalVersion = m_globalVersion;
+	return binding;
+}
+
 void AddProperty(MMMEngine::Material* _mat, const std::wstring& propName, const MMMEngine::PropertyInfo& pInfo)
 {
 	MMMEngine::PropertyValue val;
@@ -452,6 +698,7 @@ void MMMEngine::ShaderInfo::AddGlobalPropVal(const ShaderType _type, const std::
 		return;
 
 	m_globalPropMap[_type][_propName] = _value;
+	m_isGlobalDirty = true;
 }
 
 void MMMEngine::ShaderInfo::AddAllGlobalPropVal(const std::wstring _propName, const PropertyValue& _value)
@@ -463,6 +710,7 @@ void MMMEngine::ShaderInfo::AddAllGlobalPropVal(const std::wstring _propName, co
 			continue;
 
 		m_globalPropMap[key][_propName] = _value;
+		m_isGlobalDirty = true;
 	}
 }
 
@@ -478,6 +726,7 @@ void MMMEngine::ShaderInfo::SetGlobalPropVal(const ShaderType _type, const std::
 	
 	if (nit->second.index() == _value.index()) {
 		nit->second = _value;
+		m_isGlobalDirty = true;
 	}
 }
 
@@ -490,6 +739,7 @@ void MMMEngine::ShaderInfo::SetAllGlobalPropVal(const std::wstring _propName, co
 
 		if (it->second.index() == _value.index()) {
 			it->second = _value;
+			m_isGlobalDirty = true;
 		}
 	}
 }
@@ -505,6 +755,7 @@ void MMMEngine::ShaderInfo::RemoveGlobalPropVal(const ShaderType _type, const st
 		return;
 
 	tit->second.erase(nit);
+	m_isGlobalDirty = true;
 }
 
 void MMMEngine::ShaderInfo::RemoveAllGlobalPropVal(const std::wstring _propName)
@@ -515,6 +766,7 @@ void MMMEngine::ShaderInfo::RemoveAllGlobalPropVal(const std::wstring _propName)
 			continue;
 
 		map.erase(it);
+		m_isGlobalDirty = true;
 	}
 }
 
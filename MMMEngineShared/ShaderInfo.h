@@ -3,6 +3,8 @@
 #include "ExportSingleton.hpp"
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <array>
 #include <SimpleMath.h>
 #include <wrl/client.h>
 #include <d3d11_4.h>
@@ -91,7 +93,40 @@ namespace MMMEngine {
 		int registerIndex = -1;
 	};
 
+	// 프로퍼티 핸들 (프로퍼티 이름을 한번만 해시해서 얻는 정수 인덱스)
+	using PropertyHandle = int;
+	constexpr PropertyHandle INVALID_PROPERTY_HANDLE = -1;
+
+	// 핸들로 바로 접근하는 프로퍼티 정보 (쉐이더 타입별 평탄화 테이블)
+	struct FlatPropertyInfo {
+		bool valid = false;
+		PropertyType propertyType = PropertyType::Texture;
+		int bufferIndex = -1;		// 텍스쳐 tN
+		int cbufferIndex = -1;		// m_typeBufferMap[type] 내 인덱스
+		UINT offset = 0;
+		UINT size = 0;
+		ID3D11Buffer* sharedBuffer = nullptr;	// m_CBBufferMap 의 공용버퍼
+	};
+
+	// 메테리얼별로 미리 구워둔 상수버퍼 블록
+	struct BakedCBuffer {
+		std::wstring bufferName;
+		int registerIndex = -1;
+		std::vector<uint8_t> data;							// CPU 사본 (글로벌 값이 덮어써진 최종값)
+		Microsoft::WRL::ComPtr<ID3D11Buffer> buffer;		// 메테리얼 전용 GPU 버퍼
+	};
+
+	// 메테리얼 바인딩 정보 (프로퍼티나 글로벌값이 바뀔때만 재생성)
+	struct MaterialBinding {
+		ShaderType shaderType = ShaderType::S_PBR;
+		uint64_t materialVersion = UINT64_MAX;
+		uint64_t globalVersion = UINT64_MAX;
+		std::vector<BakedCBuffer> cbuffers;
+		std::vector<std::pair<UINT, ID3D11ShaderResourceView*>> srvs;	// <tN, SRV>
+	};
+
 	class RenderManager;
+	class Material;
 	class MMMENGINE_API ShaderInfo : public Utility::ExportSingleton<ShaderInfo>
 	{
 		friend class RenderManager;
@@ -104,8 +139,10 @@ namespace MMMEngine {
 		ResPtr<VShader> m_pFullScreenVS;
 		ResPtr<PShader> m_pFullScreenPS;
 
-		// 쉐이더 타입정보정의 < ShaderPath, TypeInfo >
-		std::unordered_map<std::wstring, TypeInfo> m_typeInfoMap;
+		// 쉐이더 타입정보정의 < ShaderPath, TypeHandle > (핸들은 m_typeInfos 인덱스)
+		std::unordered_map<std::wstring, int> m_typeInfoMap;
+		std::vector<TypeInfo> m_typeInfos;
+		uint32_t m_typeInfoGeneration = 0;		// StartUp 마다 증가, PShader 캐시 무효화용
 
 		// 쉐이더 타입별 사용버퍼 < ShaderType, < BufferName, RegisterIdx>>
 		std::unordered_map<ShaderType, std::vector<BufferInfo>> m_typeBufferMap;
@@ -122,12 +159,31 @@ namespace MMMEngine {
 		// 글로벌 리소스 저장용 맵 <ShaderType, <propertyName ,PropertyValue>>
 		std::unordered_map<ShaderType, std::unordered_map<std::wstring, PropertyValue>> m_globalPropMap;
 
+		// 베이크에 반영된 글로벌 값 (값이 실제로 바뀌었을때만 버전 증가)
+		std::unordered_map<ShaderType, std::unordered_map<std::wstring, PropertyValue>> m_committedGlobalPropMap;
+		uint64_t m_globalVersion = 0;
+		bool m_isGlobalDirty = false;
+
+		// 프로퍼티 이름 <-> 핸들 (재시작해도 유지)
+		std::unordered_map<std::wstring, PropertyHandle> m_propertyHandleMap;
+		std::vector<std::wstring> m_propertyNames;
+
+		// 핫패스용 평탄화 테이블 [ShaderType][PropertyHandle]
+		std::array<std::vector<FlatPropertyInfo>, ShaderType::S_END> m_flatPropertyTable;
+		// 커밋된 글로벌 값 [ShaderType] -> <PropertyHandle, Value>
+		std::array<std::vector<std::pair<PropertyHandle, PropertyValue>>, ShaderType::S_END> m_flatGlobalProps;
+
 		//// 텍스쳐 버퍼인덱스 주는 맵 <propertyName, index> (int == shader tN)
 		//std::unordered_map<ShaderType, std::unordered_map<std::wstring, int>> m_texPropertyMap;
 		
 		
 		void CreatePShaderReflection(std::wstring&& _filePath);
-		void ClearWorldPropertyDatas() { m_globalPropMap.clear(); }
+		void ClearWorldPropertyDatas() { m_globalPropMap.clear(); m_isGlobalDirty = true; }
+		void CommitGlobalProps();
+		void WriteBakedProperty(MaterialBinding& _binding, PropertyHandle _handle, const PropertyValue& _value);
+		void RegisterShaderType(const std::wstring& _shaderPath, const TypeInfo& _info);
+		void BuildPropertyTables();
+		const TypeInfo* ResolveTypeInfo(PShader* _shader);
 
 		template<typename T>
 		Microsoft::WRL::ComPtr<ID3D11Buffer> CreateConstantBuffer();
@@ -145,13 +201,25 @@ namespace MMMEngine {
 
 		const RenderType GetRenderType(const std::wstring& _shaderPath);
 		const ShaderType GetShaderType(const std::wstring& _shaderPath);
+		const RenderType GetRenderType(PShader* _shader);		// 핸들 캐시 사용 (경로 해시 없음)
+		const ShaderType GetShaderType(PShader* _shader);
+
+		PropertyHandle GetPropertyHandle(const std::wstring& _propertyName);
+		const std::wstring& GetPropertyName(PropertyHandle _handle) const;
 		const int PropertyToIdx(const ShaderType _type, const std::wstring& _propertyName, PropertyInfo* _out = nullptr) const;
 		void UpdateProperty(ID3D11DeviceContext4* context,
 			const ShaderType shaderType,
 			const std::wstring& propertyName,
 			const void* data);
+		void UpdateProperty(ID3D11DeviceContext4* context,
+			const ShaderType shaderType,
+			const PropertyHandle handle,
+			const void* data);
 		void UpdateCBuffers(const ShaderType _type);
 
+		// 메테리얼 프로퍼티를 상수블록 + SRV 테이블로 굽기 (변경 없으면 그대로 반환)
+		const MaterialBinding& BakeMaterial(ID3D11DeviceContext4* _context, Material* _mat);
+
 		void ConvertMaterialType(const ShaderType _type, Material* _mat);
 
 		void AddGlobalPropVal(const ShaderType _type, const std::wstring _propName, const PropertyValue& _value);
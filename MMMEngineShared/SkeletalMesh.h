@@ -35,6 +35,8 @@ namespace MMMEngine {
 
 		// TODO::직렬화 시켜야함
 		bool LoadFromFilePath(const std::wstring& _path) override;
+
+		size_t GetMemoryUsage() const override { return sizeof(*this) + GetMeshDataBytes(meshData) + GetMeshGPUBytes(gpuBuffer); }
 	};
 }
 
@@ -114,6 +114,8 @@ void MMMEngine::SkyRenderer::Render()
 	for (auto& [prop, val] : m_pSkyMaterial->GetProperties())
 		ShaderInfo::Get().AddAllGlobalPropVal(prop, val);
 
+	int worldMatIndex = RenderManager::Get().AddMatrix(DirectX::SimpleMath::Matrix::Identity);
+
 	for (auto& [matIdx, meshIndices] : m_pMesh->meshGroupData) {
 
 		for (const auto& idx : meshIndices) {
@@ -124,12 +126,11 @@ void MMMEngine::SkyRenderer::Render()
 			command.vertexBuffer = meshBuffer.Get();
 			command.indexBuffer = indicesBuffer.Get();
 			command.material = m_pSkyMaterial;
-			command.worldMatIndex = RenderManager::Get().AddMatrix(DirectX::SimpleMath::Matrix::Identity);
+			command.worldMatIndex = worldMatIndex;
 			command.indiciesSize = m_pMesh->indexSizes[idx];
 			command.camDistance = 0.0f;
 
-			std::wstring shaderPath = m_pSkyMaterial->GetPShader()->GetFilePath();
-			RenderType type = ShaderInfo::Get().GetRenderType(shaderPath);
+			RenderType type = ShaderInfo::Get().GetRenderType(m_pSkyMaterial->GetPShader().get());
 
 			RenderManager::Get().AddCommand(type, std::move(command));
 		}
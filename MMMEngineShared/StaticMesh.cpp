@@ -111,6 +111,9 @@ bool MMMEngine::StaticMesh::LoadFromFilePath(const std::wstring& filePath)
 		indexSizes.push_back(indices.size());
 	}
 
+	// 메시 콜라이더 쿠킹은 콜라이더가 처음 요청할 때 (PhysicsMeshCache) //렌더 전용 메시는 비용 없음
+	m_sourcePath = filePath;
+
 	// CPU 데이터 정리
 	// WARNING::필요하면 지우거나 주석처리할것 (런타임 메모리 최적화용)
 	meshData.vertices.clear();
@@ -118,3 +121,11 @@ bool MMMEngine::StaticMesh::LoadFromFilePath(const std::wstring& filePath)
 
 	return true;
 }
+
+bool MMMEngine::StaticMesh::LoadCollisionSource(MeshData& _out) const
+{
+	if (m_sourcePath.empty())
+		return false;
+
+	return ResourceSerializer::Get().DeSerialize_StaticMeshData(_out, m_sourcePath);
+}
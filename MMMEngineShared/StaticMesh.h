@@ -31,8 +31,20 @@ namespace MMMEngine {
 		bool castShadows = true;
 		bool receiveShadows = true;
 
+		// 메시 콜라이더 쿠킹 캐시 키 (정점 위치 + 인덱스 내용 해시, 임포트때 에셋에 저장됨)
+		// 0이면 해시가 저장되지 않은 이전 에셋 -> PhysicsMeshCache가 처음 요청받을 때 계산해서 채움
+		uint64_t collisionHash = 0;
+
 		// TODO::직렬화 시켜야함, 이거할때 버퍼를 만들어야함(그리고 meshData를 비움)
 		bool LoadFromFilePath(const std::wstring& filePath) override;
+
+		// 쿠킹 입력 (로드 후 CPU 데이터를 비우므로 에셋 파일에서 메시 데이터만 다시 읽음)
+		bool LoadCollisionSource(MeshData& _out) const;
+
+		size_t GetMemoryUsage() const override { return sizeof(*this) + GetMeshDataBytes(meshData) + GetMeshGPUBytes(gpuBuffer); }
+
+	private:
+		std::wstring m_sourcePath;	// LoadFromFilePath 로 받은 실제 경로
 	};
 }
 
@@ -94,3 +94,31 @@ bool MMMEngine::Texture2D::LoadFromFilePath(const std::wstring& filePath)
 
 	return false;
 }
+
+size_t MMMEngine::Texture2D::GetMemoryUsage() const
+{
+	if (!m_pSRV) return sizeof(*this);
+
+	WRL::ComPtr<ID3D11Resource> resource;
+	m_pSRV->GetResource(resource.GetAddressOf());
+
+	WRL::ComPtr<ID3D11Texture2D> texture;
+	if (!resource || FAILED(resource.As(&texture)))
+		return sizeof(*this);
+
+	D3D11_TEXTURE2D_DESC desc{};
+	texture->GetDesc(&desc);
+
+	size_t bytes = 0;
+	for (UINT mip = 0; mip < desc.MipLevels; ++mip)
+	{
+		const size_t width = (std::max)(1u, desc.Width >> mip);
+		const size_t height = (std::max)(1u, desc.Height >> mip);
+		size_t rowPitch = 0;
+		size_t slicePitch = 0;
+		if (FAILED(DirectX::ComputePitch(desc.Format, width, height, rowPitch, slicePitch)))
+			break;
+		bytes += slicePitch;
+	}
+	return sizeof(*this) + bytes * desc.ArraySize;
+}
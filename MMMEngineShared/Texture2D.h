@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 #include "Export.h"
 #include "Resource.h"
 
@@ -25,6 +25,9 @@ namespace MMMEngine {
 
 		void CreateResourceView(std::filesystem::path& _path, ID3D11ShaderResourceView** _out);
 		bool LoadFromFilePath(const std::wstring& filePath) override;
+
+		// 텍스처 desc 기준 밉 전체 크기 (GPU 메모리)
+		size_t GetMemoryUsage() const override;
 	};
 }
 
@@ -1,16 +1,93 @@
 #include "TimeManager.h"
 #include <Windows.h>
+#include <timeapi.h>
+#include <algorithm>
+#include <vector>
+
+#pragma comment(lib, "winmm.lib")
 
 DEFINE_SINGLETON(MMMEngine::TimeManager)
 
 using STD_Clock = std::chrono::steady_clock;
 
+namespace
+{
+    // Sleep(1) timeBeginPeriod(1) ¿ 1~2ms ʰ   ־ ܵδ 
+    constexpr auto kSleepMargin = std::chrono::milliseconds(2);
+}
+
+void MMMEngine::TimeManager::SetTimerPeriod(bool raise)
+{
+    if (m_timerPeriodRaised == raise)
+        return;
+
+    // Sleep ػ󵵸 1ms (⺻ 15.6ms SleepYield  κ yield  )
+    if (raise)
+        timeBeginPeriod(1);
+    else
+        timeEndPeriod(1);
+    m_timerPeriodRaised = raise;
+}
+
+void MMMEngine::TimeManager::WaitForTargetFrame()
+{
+    m_pacingWaitMs = 0.0f;
+    if (m_targetFrameRate <= 0)
+        return;
+
+    const auto period = std::chrono::duration_cast<STD_Clock::duration>(std::chrono::duration<double>(1.0 / m_targetFrameRate));
+    const auto target = m_prevTime + period;
+
+    const auto waitStart = STD_Clock::now();
+    auto now = waitStart;
+    if (m_pacingMode == FramePacingMode::SleepYield)
+    {
+        while (target - now > kSleepMargin)
+        {
+            Sleep(1);
+            now = STD_Clock::now();
+        }
+    }
+
+    while (now < target)
+    {
+        SwitchToThread();
+        now = STD_Clock::now();
+    }
+
+    m_pacingWaitMs = std::chrono::duration<float, std::milli>(now - waitStart).count();
+}
+
 void MMMEngine::TimeManager::BeginFrame()
 {
     m_frameCount++;
 
+    WaitForTargetFrame();
+
     m_currentTime = STD_Clock::now();
     auto delta = m_currentTime - m_prevTime;
+    m_prevTime = m_currentTime;
+
+    //    ð (Ŭ )
+    m_frameHistory[m_frameHistoryOffset] = std::chrono::duration<float, std::milli>(delta).count();
+    m_frameHistoryOffset = (m_frameHistoryOffset + 1) % FRAME_HISTORY;
+    m_frameHistoryCount = (std::min)(m_frameHistoryCount + 1, FRAME_HISTORY);
+    m_droppedStepsThisFrame = 0;
+    m_timeDilation = 1.0f;
+
+    if (m_deterministic)
+    {
+        //   ð   ȣθ 
+        m_fixedStepsThisFrame = m_deterministicStepsPerFrame;
+        m_unscaledDeltaTime = m_fixedDeltaTime * m_deterministicStepsPerFrame;
+        m_deltaTime = m_unscaledDeltaTime * m_timeScale;
+        m_unscaledTotalTime += m_unscaledDeltaTime;
+        m_totalTime += m_deltaTime;
+        m_accumulator = 0.0f;
+        //  Ӱ     ֽ  ׸
+        m_interpolationAlpha = 1.0f;
+        return;
+    }
 
     m_unscaledDeltaTime = std::chrono::duration<float>(delta).count();
     // clamp (ũ )
@@ -23,8 +100,6 @@ void MMMEngine::TimeManager::BeginFrame()
     m_unscaledTotalTime = std::chrono::duration<float>(total).count();
     m_totalTime = m_unscaledTotalTime * m_timeScale;
 
-    m_prevTime = m_currentTime;
-
     // fixed ٸ
     m_accumulator += m_unscaledDeltaTime;
 
@@ -36,6 +111,20 @@ void MMMEngine::TimeManager::BeginFrame()
         m_fixedStepsThisFrame++;
     }
 
+    //  ʰ  ̹  ӽð   ܸŭ 
+    if (m_maxFixedStepsPerFrame > 0 && m_fixedStepsThisFrame > m_maxFixedStepsPerFrame)
+    {
+        m_droppedStepsThisFrame = m_fixedStepsThisFrame - m_maxFixedStepsPerFrame;
+        m_fixedStepsThisFrame = m_maxFixedStepsPerFrame;
+        m_droppedFixedSteps += m_droppedStepsThisFrame;
+        ++m_budgetHitFrames;
+
+        const float droppedTime = m_droppedStepsThisFrame * m_fixedDeltaTime;
+        const float dilatedDelta = (std::max)(m_unscaledDeltaTime - droppedTime, 0.0f);
+        m_timeDilation = (m_unscaledDeltaTime > 0.0f) ? dilatedDelta / m_unscaledDeltaTime : 1.0f;
+        m_deltaTime = dilatedDelta * m_timeScale;
+    }
+
     //   (0~1)
     m_interpolationAlpha = (m_fixedDeltaTime > 0.0f)
         ? (m_accumulator / m_fixedDeltaTime)
@@ -122,6 +211,65 @@ void MMMEngine::TimeManager::ResetFrameCount()
     m_frameCount = 0;
 }
 
+void MMMEngine::TimeManager::SetDeterministic(bool value, int stepsPerFrame)
+{
+    m_deterministic = value;
+    m_deterministicStepsPerFrame = (stepsPerFrame < 1) ? 1 : stepsPerFrame;
+    m_accumulator = 0.0f;
+}
+
+void MMMEngine::TimeManager::SetTargetFrameRate(int targetFrameRate, FramePacingMode mode)
+{
+    m_targetFrameRate = (targetFrameRate < 0) ? 0 : targetFrameRate;
+    m_pacingMode = mode;
+    SetTimerPeriod(m_targetFrameRate > 0 && m_pacingMode == FramePacingMode::SleepYield);
+}
+
+void MMMEngine::TimeManager::SetMaxFixedStepsPerFrame(int maxSteps)
+{
+    m_maxFixedStepsPerFrame = (maxSteps < 0) ? 0 : maxSteps;
+}
+
+MMMEngine::FrameTimeStats MMMEngine::TimeManager::GetFrameStats() const
+{
+    FrameTimeStats stats;
+    stats.pacingWaitMs = m_pacingWaitMs;
+    stats.timeDilation = m_timeDilation;
+    stats.droppedFixedSteps = m_droppedFixedSteps;
+    stats.budgetHitFrames = m_budgetHitFrames;
+    stats.sampleCount = static_cast<uint32_t>(m_frameHistoryCount);
+    if (m_frameHistoryCount == 0)
+        return stats;
+
+    std::vector<float> samples(m_frameHistory.begin(), m_frameHistory.begin() + m_frameHistoryCount);
+    std::sort(samples.begin(), samples.end());
+
+    float sum = 0.0f;
+    for (float ms : samples)
+        sum += ms;
+
+    auto percentile = [&samples](float p)
+        {
+            const size_t idx = static_cast<size_t>(p * (samples.size() - 1) + 0.5f);
+            return samples[(std::min)(idx, samples.size() - 1)];
+        };
+
+    stats.averageMs = sum / samples.size();
+    stats.p50Ms = percentile(0.50f);
+    stats.p95Ms = percentile(0.95f);
+    stats.p99Ms = percentile(0.99f);
+    stats.maxMs = samples.back();
+    return stats;
+}
+
+void MMMEngine::TimeManager::ResetFrameStats()
+{
+    m_frameHistoryCount = 0;
+    m_frameHistoryOffset = 0;
+    m_droppedFixedSteps = 0;
+    m_budgetHitFrames = 0;
+}
+
 void MMMEngine::TimeManager::StartUp()
 {
     m_initTime = STD_Clock::now();
@@ -129,9 +277,10 @@ void MMMEngine::TimeManager::StartUp()
     m_accumulator = 0.0f;
     m_fixedTime = 0.0f;
     m_frameCount = 0;
+    ResetFrameStats();
 }
 
 void MMMEngine::TimeManager::ShutDown()
 {
-
+    SetTimerPeriod(false);
 }
\ No newline at end of file
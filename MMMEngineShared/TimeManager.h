@@ -1,6 +1,7 @@
 #pragma once
 #include "ExportSingleton.hpp"
 #include <chrono>
+#include <array>
 
 // Ʒ ǥض̺귯 (std::) dll export ֱ ڵ 
 // EngineShared ABI  Ǳ⶧ 4251  
@@ -9,6 +10,28 @@
 
 namespace MMMEngine
 {
+	// ǥ ӱ  ð ٸ 
+	enum class FramePacingMode
+	{
+		SleepYield,		// κ Sleep   ~2ms yield  (CPU  )
+		Yield,			//  yield ( ھ ϳ )
+	};
+
+	// Ʃ׿   (ֱ FRAME_HISTORY    ð )
+	struct FrameTimeStats
+	{
+		uint32_t sampleCount = 0;
+		float averageMs = 0.0f;
+		float p50Ms = 0.0f;
+		float p95Ms = 0.0f;
+		float p99Ms = 0.0f;
+		float maxMs = 0.0f;
+		float pacingWaitMs = 0.0f;			//  ӿ ǥ  ߷ ٸ ð
+		float timeDilation = 1.0f;			//   ӽð / ð (  ʰ 1 ̸)
+		uint64_t droppedFixedSteps = 0;		//  ʰ  fixed step 
+		uint32_t budgetHitFrames = 0;		// 꿡 ɸ  
+	};
+
 	class MMMENGINE_API TimeManager : public Utility::ExportSingleton<TimeManager>
 	{
 	private:
@@ -31,6 +54,32 @@ namespace MMMEngine
 		float m_interpolationAlpha = 0;
 		uint32_t m_frameCount = 0;
 
+		//   : ð ϰ Ӵ fixed step  
+		bool m_deterministic = false;
+		int m_deterministicStepsPerFrame = 1;
+
+		//  ̽ (0 ̸  )
+		int m_targetFrameRate = 0;
+		FramePacingMode m_pacingMode = FramePacingMode::SleepYield;
+		bool m_timerPeriodRaised = false;
+		float m_pacingWaitMs = 0.0f;
+
+		// Ӵ fixed step  (Ѵ   ӽð )
+		int m_maxFixedStepsPerFrame = 8;
+		int m_droppedStepsThisFrame = 0;
+		uint64_t m_droppedFixedSteps = 0;
+		uint32_t m_budgetHitFrames = 0;
+		float m_timeDilation = 1.0f;
+
+		//   ð  (ms, Ŭ )
+		static constexpr size_t FRAME_HISTORY = 512;
+		std::array<float, FRAME_HISTORY> m_frameHistory = {};
+		size_t m_frameHistoryCount = 0;
+		size_t m_frameHistoryOffset = 0;
+
+		void WaitForTargetFrame();
+		void SetTimerPeriod(bool raise);
+
 	public:
 		void StartUp();
 		void ShutDown();
@@ -58,6 +107,8 @@ namespace MMMEngine
 		const float GetMaximumAllowedTimestep() const;
 		const uint32_t GetFrameCount() const;
 		const float GetInterpolationAlpha() const;
+		int GetFixedStepsThisFrame() const { return m_fixedStepsThisFrame; }
+		int GetDroppedStepsThisFrame() const { return m_droppedStepsThisFrame; }
 	
 		void SetFixedDeltaTime(float fixedDelta);
 		void SetMaximumAllowedTimestep(float allowedTimestep);
@@ -66,6 +117,27 @@ namespace MMMEngine
 		void SetDefaultMaximumAllowedTimestep();
 
 		void ResetFrameCount();
+
+		//   (÷/Ʈũ)
+		//   Ȯ stepsPerFrame  fixed step , deltaTime fixedDeltaTime * stepsPerFrame  
+		//   ð õǹǷ  ӵ SetTargetFrameRate   
+		void SetDeterministic(bool value, int stepsPerFrame = 1);
+		bool IsDeterministic() const { return m_deterministic; }
+
+		//  ̽ : BeginFrame     + 1/targetFrameRate  ٸ  ð 
+		// vsync ų ó  ʿ  0 (⺻)
+		void SetTargetFrameRate(int targetFrameRate, FramePacingMode mode = FramePacingMode::SleepYield);
+		int GetTargetFrameRate() const { return m_targetFrameRate; }
+		FramePacingMode GetFramePacingMode() const { return m_pacingMode; }
+
+		// Ӵ fixed step 
+		//  ӿ и      ̹  deltaTime ׸ŭ 
+		// (       Ǽȯ ,  ӽð  )
+		void SetMaxFixedStepsPerFrame(int maxSteps);
+		int GetMaxFixedStepsPerFrame() const { return m_maxFixedStepsPerFrame; }
+
+		FrameTimeStats GetFrameStats() const;
+		void ResetFrameStats();
 	};
 }
 #pragma warning(pop)
\ No newline at end of file
@@ -55,6 +55,7 @@ void MMMEngine::Transform::MarkDirty()
 {
 	m_isLocalMatDirty = true;
 	m_isWorldMatDirty = true;
+	++m_worldVersion;
 	for (const auto& child : m_childs)
 	{
 		child->MarkDirty(); // 자식들도 더러워졌다고 표시
@@ -25,6 +25,9 @@ namespace MMMEngine
 		mutable DirectX::SimpleMath::Matrix m_cachedLocalMat;
 		mutable DirectX::SimpleMath::Matrix m_cachedWorldMat;
 
+		//월드 변환이 바뀔때마다 증가 (부모가 바뀐 경우 포함) //다른 시스템이 마지막으로 본 값과 비교해서 변경 여부 판단
+		uint32_t m_worldVersion = 0;
+
 		ObjPtr<Transform> m_parent;
 		std::vector<ObjPtr<Transform>> m_childs;
 
@@ -43,6 +46,7 @@ namespace MMMEngine
 
 		const DirectX::SimpleMath::Matrix& GetLocalMatrix() const;
 		const DirectX::SimpleMath::Matrix& GetWorldMatrix() const;
+		uint32_t GetWorldVersion() const { return m_worldVersion; }
 
 		const DirectX::SimpleMath::Vector3& GetLocalPosition() const;
 		const DirectX::SimpleMath::Quaternion& GetLocalRotation() const;